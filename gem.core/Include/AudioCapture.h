@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <fstream>
+#include <atomic>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// Streams the APU's output to 32-bit float WAV files on a background thread: the stereo mix as it's sent to
+// the audio ring and, optionally, one mono stem per channel with its raw level (0 to 1, before panning, master
+// volume and the front-end's masks). Write() only copies into a fixed lock-free ring and wakes the writer once
+// a quarter of it is filled, so capturing never makes the producer wait. If the writer still falls more than
+// BufferSeconds behind, the frames that don't fit are dropped and counted.
+class AudioCapture
+{
+	public:
+		AudioCapture();
+		~AudioCapture();
+
+		// The stems go next to the mix as <name>_ch1<ext> to <name>_ch4<ext>
+		bool Start(const std::string& path, int sample_rate, bool stems);
+		void Stop(); // Writes out whatever is still buffered and finishes the files
+
+		bool IsCapturing() const { return capturing; }
+		bool HasStems() const { return withStems; }
+
+		// Producer side. 'stem_frames' holds the 4 channel samples of each frame and is ignored without stems.
+		void Write(const float* mix_frames, const float* stem_frames, int frame_count);
+
+		uint64_t CapturedFrames() const { return readPos.load(std::memory_order_relaxed); }
+		uint32_t DroppedFrames() const { return droppedFrames.load(std::memory_order_relaxed); }
+
+		static const int BufferSeconds = 2;
+		static const int StemCount = 4;
+
+	private:
+		void WriterLoop();
+		void Drain();
+		void WriteHeader(std::ofstream& file, int channels, uint32_t frame_count);
+		uint64_t QueuedFrames() const { return writePos.load(std::memory_order_acquire) - readPos.load(std::memory_order_acquire); }
+
+		bool capturing;
+		bool withStems;
+		int sampleRate;
+		int channels; // Interleaved in the ring: left, right, then the stems
+
+		std::vector<float> samples;
+		uint64_t capacity;
+		uint64_t mask;
+		std::atomic<uint64_t> writePos;
+		std::atomic<uint64_t> readPos;
+		std::atomic<uint32_t> droppedFrames;
+
+		std::ofstream mixFile;
+		std::ofstream stemFiles[StemCount];
+		std::vector<float> stemScratch;
+
+		bool stopRequested;
+		std::mutex stateLock;
+		std::condition_variable wakeSignal;
+		std::thread writer;
+};
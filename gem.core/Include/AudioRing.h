@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+#include <vector>
+#include <chrono>
+
+// Durations in ms counted into fixed width buckets, the last of which also takes everything above it.
+// Recorded from one thread, the counts can be read from any.
+class AudioHistogram
+{
+	public:
+		static const int BucketCount = 10;
+
+		AudioHistogram(float bucket_ms);
+		void Add(float ms);
+		void Reset();
+
+		float BucketWidth() const { return bucketWidth; }
+		uint32_t Count(int bucket) const { return counts[bucket].load(std::memory_order_relaxed); }
+		uint32_t Total() const { return total.load(std::memory_order_relaxed); }
+		float Mean() const;
+		float Max() const { return maxValue.load(std::memory_order_relaxed); }
+
+	private:
+		float bucketWidth;
+		std::atomic<uint32_t> counts[BucketCount];
+		std::atomic<uint32_t> total;
+		std::atomic<float> sum;
+		std::atomic<float> maxValue;
+};
+
+// Lock-free single-producer/single-consumer ring of interleaved stereo frames. The APU writes into it from
+// the emulation thread and the audio device's callback reads from it, so neither side ever blocks, sleeps
+// or allocates. A write that doesn't fit is cut short (an overrun) and a read that can't be satisfied is
+// padded with the last frame played (an underrun).
+class AudioRing
+{
+	public:
+		AudioRing(int capacity_frames); // Rounded up to a power of two
+
+		// Producer side
+		int Write(const float* frames, int frame_count);
+
+		// Consumer side
+		int Read(float* dest, int frame_count);
+		void Clear();
+
+		int QueuedFrames() const { return int(writePos.load(std::memory_order_acquire) - readPos.load(std::memory_order_acquire)); }
+		int Capacity() const { return int(capacity); }
+
+		uint32_t Underruns() const { return underruns.load(std::memory_order_relaxed); }
+		uint32_t PaddedFrames() const { return paddedFrames.load(std::memory_order_relaxed); }
+		uint32_t Overruns() const { return overruns.load(std::memory_order_relaxed); }
+		void ResetCounters();
+
+		// Once it knows the rate the frames are played at, each write records how much was still queued ahead
+		// of it (how close the device came to running dry) and how long it has been since the last write
+		void SetSampleRate(int rate) { sampleRate = rate; }
+		const AudioHistogram& FillAtWrite() const { return fillAtWrite; }
+		const AudioHistogram& WriteInterval() const { return writeInterval; }
+
+	private:
+		std::vector<float> samples;
+		uint32_t capacity;
+		uint32_t mask;
+
+		// Total frames written/read so far. Only the owning side stores to each of them.
+		std::atomic<uint32_t> writePos;
+		std::atomic<uint32_t> readPos;
+
+		std::atomic<uint32_t> underruns;
+		std::atomic<uint32_t> paddedFrames;
+		std::atomic<uint32_t> overruns;
+
+		int sampleRate;
+		AudioHistogram fillAtWrite;
+		AudioHistogram writeInterval;
+		std::chrono::steady_clock::time_point lastWrite; // Producer only
+
+		float lastLeft;
+		float lastRight;
+};
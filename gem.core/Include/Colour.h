@@ -12,7 +12,6 @@
 #define USE_PALETTE				1
 
 #define DECLARE_COLOUR_STANDALONE(Name,R,G,B) static const GemColour& Name() { static GemColour* c = new GemColour((R),(G),(B)); return *c; }
-#define DECLARE_COLOUR(Name,R,G,B) static const GemColour& Name() { if (!_##Name) { _##Name = new GemColour((R),(G),(B)); } return *_##Name; }
 #define DECLARE_PIXEL(Name,R,G,B,A) static const Pixel& Name() { static Pixel* px = new Pixel(R,G,B,A); return *px; }
 
 enum class CorrectionMode
@@ -21,6 +20,14 @@ enum class CorrectionMode
 	Scale
 };
 
+// Byte order of a packed pixel in memory. Frames are produced in the order the
+// presenter wants so they can be copied straight into a texture.
+enum class PixelFormat
+{
+	BGRA, // SDL_PIXELFORMAT_BGRA32 / GL_BGRA
+	RGBA  // SDL_PIXELFORMAT_RGBA32 / GL_RGBA
+};
+
 struct GemColour
 {
 	uint8_t Red;
@@ -42,49 +49,54 @@ struct GemColour
 	GemColour& operator=(const GemColour& Other);
 	void Correct();
 	void Correct(CorrectionMode mode, float brightness);
-	bool ReplaceWithSpritePixel(const GemColour& replace_with, int colour_number, bool behind_bg, bool force);
+	uint32_t Pack(PixelFormat format) const;
+	static GemColour Unpack(uint32_t pixel, PixelFormat format);
 
 	DECLARE_COLOUR_STANDALONE(Black, 0, 0, 0)
 	DECLARE_COLOUR_STANDALONE(Purple, 112, 48, 160)
 	DECLARE_COLOUR_STANDALONE(White, 255, 255, 255)
 };
 
+// The 4 shades used to display DMG games. Each GPU owns its own copy so that
+// several cores can run side by side with different palettes.
 class GemPalette
 {
 public:
+	GemPalette();
+
+	// Default shades
 #if USE_PALETTE == COLOUR_PALETTE_GREEN
-	DECLARE_COLOUR(Black, 0, 0, 0)
-	DECLARE_COLOUR(DarkGrey, 48, 108, 80)
-	DECLARE_COLOUR(LightGrey, 136, 192, 112)
-	DECLARE_COLOUR(White, 224, 248, 208)
+	DECLARE_COLOUR_STANDALONE(Black, 0, 0, 0)
+	DECLARE_COLOUR_STANDALONE(DarkGrey, 48, 108, 80)
+	DECLARE_COLOUR_STANDALONE(LightGrey, 136, 192, 112)
+	DECLARE_COLOUR_STANDALONE(White, 224, 248, 208)
 #else
-	DECLARE_COLOUR(Black, 208, 57, 127)
-	DECLARE_COLOUR(DarkGrey, 249, 99, 152)
-	DECLARE_COLOUR(LightGrey, 252, 167, 184)
-	DECLARE_COLOUR(White, 250, 255, 206)
+	DECLARE_COLOUR_STANDALONE(Black, 208, 57, 127)
+	DECLARE_COLOUR_STANDALONE(DarkGrey, 249, 99, 152)
+	DECLARE_COLOUR_STANDALONE(LightGrey, 252, 167, 184)
+	DECLARE_COLOUR_STANDALONE(White, 250, 255, 206)
 #endif
 
-	static void ReAssign(int colour_number, const GemColour& colour);
+	const GemColour& GetColour(int colour_number) const { return colours[colour_number]; }
+	void ReAssign(int colour_number, const GemColour& colour);
 
 private:
-	static GemColour* _Black;
-	static GemColour* _DarkGrey;
-	static GemColour* _LightGrey;
-	static GemColour* _White;
+	GemColour colours[4]; // Colour 0 is the lightest shade
 };
 
-#undef DECLARE_COLOUR
-
-struct ColourBuffer : public DArray<GemColour>
+// Packed 32-bit pixels, used for anything that ends up in a texture
+struct PixelBuffer : public DArray<uint32_t>
 {
-	ColourBuffer();
-	ColourBuffer(int w, int h);
-	void CorrectPixel(int x, int y, CorrectionMode mode = CorrectionMode::Washout);
+	PixelBuffer();
+	PixelBuffer(int w, int h, PixelFormat format = PixelFormat::BGRA);
 	GemColour GetPixel(int x, int y) const;
-	void SetPixel(int x, int y, const GemColour& Colour);
-	const GemColour* Copy(GemColour* dest = nullptr) const;
+	void SetPixel(int x, int y, const GemColour& colour);
+	void SetPixel(int index, const GemColour& colour) { pData[index] = colour.Pack(Format); }
+	void Fill(const GemColour& colour);
+	void Convert(PixelFormat format); // Repacks the existing pixels
 	void Zero();
 
 	int Width;
 	int Height;
+	PixelFormat Format;
 };
\ No newline at end of file
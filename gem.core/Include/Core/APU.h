@@ -5,13 +5,17 @@
 #include <memory>
 #include <mutex>
 #include <functional>
+#include <vector>
 
-#include "DArray.h"
-#include "IAudioQueue.h"
+#include "AudioCapture.h"
+#include "AudioRing.h"
 #include "Core/APURegisters.h"
+#include "Core/BlipBuffer.h"
 
 #define NUM_EMITTERS 4
 
+class SoundWorker;
+
 struct EmittersSnapshot
 {
 	EmittersSnapshot()
@@ -34,8 +38,13 @@ class APU
 {
 public:
 	APU();
-	void SetAudioQueue(IAudioQueue* queue);
+	void SetAudioRing(AudioRing* ring);
+	void SetCapture(AudioCapture* sink); // Gets every frame at the nominal sample rate, whatever the rate adjustment (nothing while silent)
+	void SetSampleRate(int rate);
+	int SampleRate() const { return sampleRate; }
+	void SetRateAdjustment(float ratio); // Renders ratio * 100 percent more samples per emulated second (takes effect from the next frame)
 	void Reset();
+	void ForkFrom(const APU& parent); // Samples the parent hasn't pushed yet are left with the parent
 	void TickEmitters(int m_cycles);
 
 	uint8_t ReadRegister(uint16_t addr);
@@ -44,23 +53,39 @@ public:
 	uint8_t ReadWaveRAM(uint16_t addr);
 	void WriteWaveRAM(uint16_t addr, uint8_t value);
 
-	void SetMuted(bool muted) { mute = muted; }
+	void SetMuted(bool muted);
 	void SetChannelMask(int chan_index, uint8_t mask);
 	void DecodeWaveRAM(uint8_t dest[32]);
-	int BufferCount() const { return buffer.Count(); }
-	void ClearBuffer() { buffer.Truncate(0); }
+	void ClearBuffer();
 	APUControlRegisters& Controller() { return controller; }
-	EmittersSnapshot Snapshot() const { return snapshot; }
-	static const int AudioQueueSampleCount = 4096;
+	EmittersSnapshot Snapshot() const;
+
+	// Threaded synthesis logs every register and wave RAM write to a SoundWorker, which renders the samples on
+	// its own thread. This APU still applies the writes and runs the frame sequencer so reads are answered
+	// straight away, but never advances the channels.
+	void SetThreaded(bool enabled);
+	bool IsThreaded() const { return soundWorker != nullptr; }
+	void Flush(); // Waits until everything emulated so far has been rendered, e.g. before a capture is closed
+
+	// A silent APU only runs the frame sequencer (lengths, sweep and envelopes) and generates no samples.
+	// Register reads, NR52 included, are the same as when sound is on: a channel shows as on from its trigger
+	// until its length runs out, its sweep overflows or its DAC is turned off.
+	void SetSilent(bool enabled);
+	bool IsSilent() const { return silent; }
+
+	// Whether ticking writes samples to the audio ring, which it doesn't while silent or while NR52 has sound off
+	bool IsProducingSamples() const { return audioRing && !silent && controller.IsSoundOn(); }
 
 private:
 	static const int AmplitudeScale = SHRT_MAX / (NUM_EMITTERS * 8); // Max volume level = 8; Num channels = 4
 	
 	uint8_t waveRAM[GemConstants::WaveRAMSizeBytes];
+	uint8_t waveSamples[GemConstants::WaveRAMSize]; // Decoded by WriteWaveRAM, channel 3 plays from these
 
 	// An additional mask that the front-end can use to mute channels
 	uint8_t chanMask[NUM_EMITTERS];
 	bool mute;
+	bool silent;
 
 	EmittersSnapshot snapshot;
 	
@@ -70,11 +95,58 @@ private:
 	Channel3Registers chan3;
 	Channel4Registers chan4;
 
-	int sampleTAcc;
+	// Frame sequencer shared by all channels. Steps at 512Hz, clocking length on even steps,
+	// sweep on steps 1 and 5 and the envelopes on step 6.
+	int sequencerTAcc;
+	int sequencerStep;
+
 	SquareWaveEmitter emitter1;
 	SquareWaveEmitter emitter2;
 	ProgrammableWaveEmitter emitter3;
 	NoiseEmitter emitter4;
-	DArray<float> buffer;
-	IAudioQueue* audioQueue;
+
+	// The mixed output levels (sum of amplitude * volume of each channel) go into the blip buffers
+	// as steps. The mix is only redone where a channel can change or after a register write, and a
+	// frame is closed (its samples written to the audio ring) on every frame sequencer step.
+	BlipBuffer blipLeft;
+	BlipBuffer blipRight;
+	int sampleRate;
+	int tunedSampleRate; // sampleRate with the rate adjustment applied
+	int frameTCycles;
+	int mixedLeft;
+	int mixedRight;
+	bool mixDirty;
+
+	std::vector<float> frameSamples; // Sized for the longest frame when the sample rate is set
+	AudioRing* audioRing;
+
+	// A capture gets its own copy of the mix at the nominal sample rate so the rate adjustment never reaches
+	// the file, and each channel's level goes into its own buffer as well while it wants stems
+	AudioCapture* capture;
+	BlipBuffer captureLeft;
+	BlipBuffer captureRight;
+	std::vector<float> captureSamples;
+	BlipBuffer stemBlips[NUM_EMITTERS];
+	int stemLevels[NUM_EMITTERS];
+	std::vector<float> stemSamples;
+
+	// Set while threaded. emulatedCycles is the timeline writes are logged against, handed to the worker
+	// every SoundWorker::PublishInterval cycles. Anything that reads or changes the synthesis state has to
+	// call FinishSynthesis() first. The worker is left idle while silent and resynced afterwards.
+	std::shared_ptr<SoundWorker> soundWorker;
+	uint64_t emulatedCycles;
+	uint64_t publishedCycles;
+	void FinishSynthesis();
+
+	// Runs the frame sequencer without advancing the channels (silent or threaded)
+	void TickRegisters(int t_cycles);
+	void UpdateChannelStatus();
+
+	// The channel registers and wave emitter hold pointers back into this object
+	void LinkEmitters();
+	void StepFrameSequencer();
+	void MixOutput();
+	void EndFrame();
+
+	friend class SoundWorker;
 };
\ No newline at end of file
@@ -1,12 +1,17 @@
-
 #pragma once
 
 #include <vector>
 #include <memory>
+#include <climits>
 
 #include "Core/GemConstants.h"
 #include "DArray.h"
 
+// The emitters are plain concrete types. Rather than being ticked once per T-cycle, each one
+// is advanced by a whole span of cycles with Advance() and jumps straight from one waveform
+// edge (or LFSR shift) to the next. The APU owns the frame sequencer and calls the length,
+// sweep and envelope units directly. CyclesUntilChange() tells the APU how far a channel can
+// be advanced before its output might change (INT_MAX while it is silent and stays silent).
 class SoundEmitter
 {
 	friend class Channel1Registers;
@@ -16,19 +21,15 @@ class SoundEmitter
 	friend class APU;
 
 public:
-	SoundEmitter::SoundEmitter(int channel_number);
-	void Tick();
+	SoundEmitter(int channel_number);
 	void Start() { emit = true; }
 	void Stop() { emit = false; }
 
-	virtual void TickTClock() = 0;
-	virtual void Tick256Hz();
-	virtual void Tick128Hz() {}
-	virtual void Tick64Hz() {}
-	virtual ~SoundEmitter() {}
+	void TickLength();
 
 	const int ChannelNo() const { return channelNum; }
 	const bool IsEmitting() const { return gatedAmplitude > 0; }
+	const bool IsEnabled() const { return emit && dacOn; } // Triggered and not stopped by its length, sweep or DAC since
 	const uint8_t Sample() const { return gatedAmplitude; }
 	void Mute() { emit = false; }
 
@@ -40,24 +41,11 @@ protected:
 	int channelNum;
 	bool dacOn;
 
-	int sequencerTAcc;
-	int sequencerStep;
-
 	// All 4 channels have this feature
 	uint8_t soundLenCtr;
 	bool stopAfterLen;
 };
 
-// Used to test the mixer
-class SinusoidEmitter : public SoundEmitter
-{
-public:
-	SinusoidEmitter();
-	virtual void TickTClock() override;
-private:
-	double x;
-};
-
 class SquareWaveEmitter : public SoundEmitter
 {
 public:
@@ -65,9 +53,10 @@ public:
 	friend class Channel2Registers;
 
 	SquareWaveEmitter(int channel_number);
-	virtual void TickTClock() override;
-	virtual void Tick128Hz() override;
-	virtual void Tick64Hz() override;
+	void Advance(int t_cycles);
+	int CyclesUntilChange() const { return (emit && dacOn) || gatedAmplitude ? (waveTCtr == 0 ? 0x10000 : waveTCtr) : INT_MAX; }
+	void TickSweep();
+	void TickEnvelope();
 	void SetWavePeriodData(uint16_t value);
 	void Reset(uint16_t freq_data, uint8_t freq_sweep_time, bool freq_decreasing, uint8_t freq_divider, uint8_t duty_cycle, uint8_t initial_envelope_volume, bool volume_increasing, uint8_t envelope_steps, bool dac_on, uint8_t duration, bool stop_after_counter);
 
@@ -79,7 +68,7 @@ private:
 	uint8_t freqDivider;
 
 	// Freq state
-	uint16_t waveTCtr;
+	uint16_t waveTCtr; // Cycles until the next duty step; 0 wraps around to a full 65536
 	uint8_t dutyCycleCode;
 	uint8_t sweepTicksPerShift;
 	uint8_t sweepCtr; // Counts down until the frequency shifts
@@ -98,18 +87,19 @@ class ProgrammableWaveEmitter : public SoundEmitter
 	friend class APU;
 
 public:
-	ProgrammableWaveEmitter(int channel_number, uint8_t wave_ram[]);
-	virtual void TickTClock() override;
+	ProgrammableWaveEmitter(int channel_number, uint8_t wave_samples[]);
+	void Advance(int t_cycles);
+	int CyclesUntilChange() const { return (emit && dacOn && amplitudeDivider) || gatedAmplitude ? (waveTCtr == 0 ? 0x10000 : waveTCtr) : INT_MAX; }
 	void SetWavePeriodData(uint16_t value);
 	void Reset(uint16_t freq_data, uint8_t duration, bool stop_after_counter, uint8_t amp_divider, bool dac_on);
 
 private:
-	uint8_t* waveRAM;
+	uint8_t* waveSamples; // The APU's wave RAM decoded to one 4 bit sample per byte
 	int sampleIdx;
 	uint8_t amplitudeDivider;
 
 	uint16_t periodData;
-	uint16_t waveTCtr;
+	uint16_t waveTCtr; // Same wrap-around as SquareWaveEmitter::waveTCtr
 	int tCyclesPerWave;
 };
 
@@ -119,16 +109,26 @@ class NoiseEmitter : public SoundEmitter
 
 public:
 	NoiseEmitter(int channel_number);
-	virtual void TickTClock() override;
-	virtual void Tick64Hz() override;
+	void Advance(int t_cycles);
+	int CyclesUntilChange() const { return ((emit && dacOn) || gatedAmplitude) && shiftCtr > 0 ? shiftCtr : INT_MAX; }
+	void TickEnvelope();
 	void SetShiftPeriodData(uint8_t base_period_code, uint8_t multiplier);
+	void SetShortMode(bool short_mode);
 	void Reset(uint8_t base_period_code, uint8_t multiplier, bool short_mode, uint8_t initial_envelope_volume, bool volume_increasing, uint8_t envelope_steps, bool dac_on, uint8_t duration, bool stop_after_counter);
 
+	uint16_t ShiftRegister() const;
+
+	static const int LongSequenceLength = 0x7FFF;
+	static const int ShortSequenceLength = 0x7F;
+
 private:
-	uint8_t amplitude;
+	// The LFSR always starts from 7FFFh so rather than shifting it, the emitter keeps its position in the
+	// precomputed output of either width. The register itself is only rebuilt when the width changes.
+	int lfsrIdx; // -1 once the bits within the width are all zero, which the LFSR never leaves
+	uint16_t entryRegister; // Register when the current width was selected, its top bits linger in short mode
+	int shiftsSinceEntry; // Saturates once those bits have all been shifted out
 
-	uint16_t shiftRegister;
-	int shiftCtr;
+	int shiftCtr; // Stays idle once it runs out without a period to reload from
 	int tCyclesPerShift;
 	bool shortMode;
 
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Band-limited step synthesis. Instead of point sampling the channels, every change in the output level
+// is added as a delta at its exact clock time and spread over the neighbouring output samples with a
+// windowed sinc, so the buffer can be read back at any sample rate without aliasing. Clock time is kept
+// as an exact fraction of an output sample (clock_rate units per sample), so there is no drift in pitch.
+class BlipBuffer
+{
+	public:
+		BlipBuffer();
+
+		void SetRates(long clock_rate, int sample_rate, int max_frame_cycles);
+		void Clear();
+
+		// Changes the output rate without discarding anything. Only valid between frames, and at most
+		// 1% above the rate given to SetRates() since the buffer is sized for that.
+		void Retune(int sample_rate) { sampleRate = sample_rate; }
+
+		// Adds a step of 'delta' at 't_cycle' clocks into the current frame
+		void AddDelta(int t_cycle, int delta);
+
+		// Closes the current frame after 't_cycles' clocks, making its samples available for reading
+		void EndFrame(int t_cycles);
+
+		int SamplesAvailable() const { return int(offset / clockRate); }
+		float ReadSample();
+
+		int SampleRate() const { return sampleRate; }
+
+		static const int Unit = 1 << 15; // Sum of one kernel phase
+
+	private:
+		static const int KernelWidth = 16;
+		static const int KernelPhases = 64;
+
+		long clockRate;
+		int sampleRate;
+
+		int64_t offset; // Start of the current frame, in 1/clockRate samples past the read position
+		uint32_t readPos;
+		uint32_t mask;
+		int32_t integrator;
+		std::vector<int32_t> deltas;
+
+		int16_t kernel[KernelPhases][KernelWidth];
+};
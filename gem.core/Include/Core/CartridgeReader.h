@@ -93,6 +93,7 @@ class CartridgeReader
 		uint8_t* GetRomDataPointer() const { return romData; }
 
 		void LoadFile(const char* file);
+		void LoadImage(const uint8_t* data, unsigned int data_size); // A ROM built in memory, it has no save file
 		bool IsLoaded() const { return isLoaded; }
 
 		// Header data
@@ -107,6 +108,9 @@ class CartridgeReader
 		static void DecodeHeader(const uint8_t header_data[], CartridgeProperties& props);
 
 	private:
+		void Allocate(unsigned int data_size);
+		void DecodeImage();
+
 		bool isLoaded;
 
 		CartridgeProperties cartProps;
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Core/CartridgeReader.h"
+
+struct GBSHeader
+{
+	int Version;
+	int SongCount;
+	int FirstSong; // 1 based
+	uint16_t LoadAddress;
+	uint16_t InitAddress;
+	uint16_t PlayAddress;
+	uint16_t StackPointer;
+	uint8_t TimerModulo;
+	uint8_t TimerControl;
+	std::string Title;
+	std::string Author;
+	std::string Copyright;
+};
+
+// A Game Boy Sound System rip: a game's music driver and data plus a header with the addresses to call.
+// BuildImage() wraps it in an MBC5 ROM image the core runs like any cartridge. The code is placed at its
+// load address, the RST vectors jump to their counterparts past it and a small driver at 0150h sets up the
+// sound registers, calls the init routine with the song number and then calls the play routine from the
+// VBlank interrupt, or the timer interrupt when the header asks for it.
+class GBSFile
+{
+	public:
+		GBSFile();
+
+		void LoadFile(const char* file);
+		bool IsLoaded() const { return !data.empty(); }
+		const GBSHeader& Header() const { return header; }
+
+		bool UsesTimer() const { return (header.TimerControl & 0x04) != 0; }
+		bool UsesDoubleSpeed() const { return (header.TimerControl & 0x80) != 0; } // Needs CGB mode
+
+		std::shared_ptr<CartridgeReader> BuildImage(int song) const; // 'song' is 0 based
+
+		static const int HeaderSize = 0x70;
+		static const uint16_t DriverAddress = 0x150;
+		static const uint16_t MinLoadAddress = 0x200; // Leaves room for the vectors, cartridge header and driver
+
+	private:
+		GBSHeader header;
+		std::vector<uint8_t> data;
+};
@@ -8,33 +8,19 @@
 #include "Core/CartridgeReader.h"
 #include "Core/InterruptController.h"
 #include "DArray.h"
+#include "CowBuffer.h"
 #include "Colour.h"
 #include "IDrawTarget.h"
 #include "IMappedComponent.h"
 
-struct TilePixelRow
-{
-	TilePixelRow();
-	TilePixelRow(const int* arr);
-	uint8_t* Ptr();
-	uint8_t operator[](int index);
-	void CopyToArray(int* arr);
-
-	uint8_t p0;
-	uint8_t p1;
-	uint8_t p2;
-	uint8_t p3;
-	uint8_t p4;
-	uint8_t p5;
-	uint8_t p6;
-	uint8_t p7;
-};
+class RenderWorker;
 
 class GPU
 {
 	public:
 		GPU();
 		void Reset(bool bCGB);
+		void ForkFrom(const GPU& parent); // VRAM is shared copy-on-write with the parent
 		void TickStateMachine(int t_cycles);
 
 		uint8_t ReadByteVRAM(uint16_t addr);
@@ -54,6 +40,8 @@ class GPU
 		ColourPalette& GetSpriteColourPalette() { return sprColourPalette; }
 		MonochromePalette& GetBgMonochromePalette() { return bgMonoPalette; }
 		MonochromePalette& GetSpriteMonochromePalette(int index) { return sprMonoPalettes[index]; }
+		const GemPalette& GetDMGPalette() const { return dmgPalette; }
+		void SetDMGPalette(const GemPalette& palette);
 
 		LCDPositions& GetLCDPositions() { return positions; }
 		LCDStatusRegister& GetLCDStatus() { return stat; }
@@ -68,18 +56,40 @@ class GPU
 		LCDMode GetMode() const { return stat.Mode; }
 		void SetMode(LCDMode mode) { stat.Mode = mode; }
 
-		const ColourBuffer& GetFrameBuffer() { return frameBuffer; }
-		void ClearFrameBuffer() { frameBuffer.Zero(); }
+		const PixelBuffer& GetFrameBuffer() { FinishRendering(); return frameBuffer; }
+		const DArray<uint8_t>& GetPixelAttributes() { FinishRendering(); return pixelAttributes; }
+		void ClearFrameBuffer();
+
+		PixelFormat GetPixelFormat() const { return frameBuffer.Format; }
+		void SetPixelFormat(PixelFormat format);
 
-		void RenderSpritesViz(ColourBuffer* out_buffers, SpriteData* out_sprites);
-		void RenderTilesViz(int tile_set, ColourBuffer* out_buffers, CGBTileAttribute* out_attrs, uint16_t* addrs);
-		void RenderPalettesViz(ColourBuffer* out_buffers, ColourPalette::PaletteEntry* out_entries);
+		void RenderSpritesViz(PixelBuffer* out_buffers, SpriteData* out_sprites);
+		void RenderTilesViz(int tile_set, PixelBuffer* out_buffers, CGBTileAttribute* out_attrs, uint16_t* addrs);
+		void RenderPalettesViz(PixelBuffer* out_buffers, ColourPalette::PaletteEntry* out_entries);
 
 		CorrectionMode GetColourCorrectionMode() const { return correctionMode; }
-		void SetColourCorrectionMode(CorrectionMode mode) { correctionMode = mode; }
+		void SetColourCorrectionMode(CorrectionMode mode);
 
 		float GetBrightness() const { return brightness; }
-		void SetBrightness(float value) { brightness = value; }
+		void SetBrightness(float value);
+
+		// Frame skipping: of every frames+1 frames only the last is rendered, starting from the next frame.
+		// Skipped frames keep the same mode timing and interrupts, only their pixels aren't generated.
+		void SetFrameSkip(int frames);
+		int GetFrameSkip() const { return frameSkip; }
+		bool IsFrameRendered() const { return renderingFrame; } // Whether the current (or just finished) frame is being drawn
+
+		// Pipelined rendering hands each line to a RenderWorker at the end of mode 3 and carries on emulating
+		// while it's drawn. The frame buffer catches up whenever it's read.
+		void SetPipelined(bool enabled);
+		bool IsPipelined() const { return renderWorker != nullptr; }
+
+		// Accurate mode 3 lengthens mode 3 by the SCX, window and sprite penalties instead of a fixed 172 cycles.
+		// Lines with a register write during mode 3 are then drawn as they go, so the pixels already pushed
+		// keep the old values and the rest get the new ones. Other lines still render in one go. Mid-line
+		// drawing is skipped while pipelined.
+		void SetAccurateMode3(bool enabled) { accurateMode3 = enabled; }
+		bool IsAccurateMode3() const { return accurateMode3; }
 
 		// Even if running a DMG-only game, we reserve the extra bank
 		static const int VRAMSize = 0x2000 * 2; // 8kb * 2 banks
@@ -96,28 +106,153 @@ class GPU
 		static const int PalettesViewWidth = 83;
 		static const int PalettesViewHeight = 125;
 
+		// Layout of a pixel attribute byte
+		static const uint8_t AttrColourNumber = 0x03; // Colour number of the BG/window/sprite pixel on top
+		static const uint8_t AttrPriority = 0x80; // CGB BG-to-OAM priority of the BG/window tile
+
 	private:
 		bool bCGB;
 		int tAcc; // Accumulates T cycles
 
-		void RenderLine();
-		void RenderBGLine();
-		void RenderWindowLine();
-		void RenderSpriteLine();
-		void GetTilePixelRow(int line_pos, TilePixelRow& pixels, CGBTileAttribute& tile_attr);
-		void GetWindowTilePixelRow(int line_pos, TilePixelRow& pixels, CGBTileAttribute& tile_attr);
-		void ReadPixels(TilePixelRow& pixels, int vram_index, bool read_bank_1, bool horizontal_flip);
-		void DecodePixels(TilePixelRow& pixels, uint8_t b0, uint8_t b1, bool horizontal_flip);
+		// The renderers are specialised for DMG and CGB so neither mode pays for the other's checks.
+		// SelectModePath() picks the right instantiation whenever bCGB changes.
+		typedef void (GPU::*RenderLineFunc)();
+		RenderLineFunc renderLine;
+		void SelectModePath();
+
+		template<bool CGB> void RenderLine();
+		template<bool CGB> void RenderBGLine(int start, int end);
+		template<bool CGB> bool RenderWindowLine(int start, int end); // Returns whether the window is on this line
+		template<bool CGB> void RenderSpriteLine(int start, int end);
+		bool IsWindowOnLine(bool cgb) const;
+
+		// Mid-line drawing for accurate mode 3. pixelStalls[x] is how many extra cycles go by before pixel x
+		// is pushed, pixel 0 is pushed 12 cycles into mode 3 at the earliest and one more follows every cycle.
+		bool accurateMode3;
+		int mode3Length;
+		uint8_t pixelStalls[LCDWidth + 1];
+		bool midLineActive;
+		bool midLineWindow;
+		int midLineX; // Next pixel to draw
+		int midLineCycle; // When it's pushed
+		int ComputeMode3Length();
+		void CatchUpLine();
+		void FinishMidLine();
+		typedef void (GPU::*RenderPixelsFunc)(int);
+		RenderPixelsFunc renderPixelsUntil;
+		template<bool CGB> void RenderPixelsUntil(int cycle);
+
+		// Whether a frame is rendered is decided on its first line. Skipped lines only
+		// advance the window's line counter so the rendered frames come out the same.
+		int frameSkip;
+		int framesUntilRender;
+		bool frameStarted;
+		bool renderingFrame;
+		void BeginFrame();
+		void SkipLine();
+
+		// Set while pipelined. Anything that changes the video state other than through register, VRAM and
+		// OAM writes has to call FinishRendering() first if it needs the frame, and SyncRenderWorker() after.
+		std::shared_ptr<RenderWorker> renderWorker;
+		void FinishRendering();
+		void SyncRenderWorker();
+
+		// All 384 tiles of each VRAM bank decoded into colour numbers (8 bytes per row), plus a horizontally
+		// flipped copy. Every write to tile data goes through WriteVRAM() so the renderers never touch bitplanes.
+		static const int NumTilesPerBank = 384;
+		static const int NumCachedTiles = NumTilesPerBank * 2;
+		uint8_t tileCache[NumCachedTiles * 64];
+		uint8_t tileCacheFlipped[NumCachedTiles * 64];
+		void WriteVRAM(int index, uint8_t value);
+		void UpdateTileCacheRow(int vram_index);
+		void RebuildTileCache();
+		const uint8_t* GetTileRow(int vram_index, bool read_bank_1, bool horizontal_flip) const;
+		static bool IsBlankRow(const uint8_t* row);
+
+		// Both 32x32 tile maps kept drawn as 256x256 layers of colour numbers, with each entry's palette
+		// and BG priority alongside. Map writes mark their entry and tile data writes mark their tile;
+		// the affected entries are redrawn before the next line renders, so BG and window lines are copies.
+		static const int NumMapEntries = 32 * 32;
+		static const int MapLayerSize = TileMapWidth * TileMapHeight;
+		static const uint8_t MapAttrPalette = 0x07;
+		uint8_t mapLayers[MapLayerSize * 2];
+		uint8_t mapLayerAttrs[NumMapEntries * 2];
+		bool mapEntryDirty[NumMapEntries * 2];
+		uint16_t dirtyMapEntries[NumMapEntries * 2];
+		int numDirtyMapEntries;
+		bool tileChanged[NumCachedTiles];
+		bool anyTileChanged;
+		int mapLayersTileDataSelect;
+		int GetMapEntryTile(int entry, CGBTileAttribute& tile_attr);
+		void MarkMapEntryDirty(int entry);
+		void MarkAllMapEntriesDirty();
+		void RefreshMapLayers();
+		void RenderMapEntry(int entry);
+
+		// Palette colours resolved and packed at the start of each line so compositing a run
+		// of pixels is a straight table lookup.
+		struct LineShades
+		{
+			uint32_t BG[32]; // [palette * 4 + colour number]
+			uint32_t Sprite[32]; // [palette * 4 + colour number], DMG uses palettes 0-1
+		};
+		LineShades lineShades;
+		template<bool CGB> void ResolveLineShades();
+
+		// The CGB palettes after colour correction and brightness, in the same layout as the line shades.
+		// Entries are updated as palette data is written and rebuilt when the correction settings change.
+		LineShades correctedShades;
+		void UpdateCorrectedShade(ColourPalette& palette, int entry_index);
+		void RebuildCorrectedShades();
+
+		// Lines are only rendered again when something that feeds them has changed since the last frame,
+		// otherwise last frame's pixels stay. videoVersion counts every change to VRAM, OAM and the
+		// palettes; the registers a line depends on are compared directly.
+		struct LineKey
+		{
+			uint32_t Version;
+			uint8_t Control;
+			uint8_t ScrollX;
+			uint8_t ScrollY;
+			uint8_t WindowX;
+			uint8_t WindowY;
+			uint8_t WindowLineY;
+			uint8_t MonoPalettes[3];
+
+			bool operator==(const LineKey& other) const;
+		};
+		struct LineMemo
+		{
+			LineKey Key;
+			uint8_t WindowLinesAdvanced;
+		};
+		uint32_t videoVersion;
+		LineMemo lineMemos[LCDHeight];
+		LineKey GetLineKey() const;
 
 		void IncLineY();
 		void LycLyCompare();
 
 		int vramBank;
 		int vramOffset;
-		DArray<uint8_t> vram; 
+		CowBuffer vram; // Shared copy-on-write with forks
 		DArray<uint8_t> oam;
 		SpriteData sprites[NumSprites];
 
+		// Sprites covering each line, in drawing order and capped at 10. They're rebuilt on the
+		// next rendered line after OAM or the sprite size changes.
+		static const int MaxSpritesPerLine = 10;
+		struct SpriteLine
+		{
+			uint8_t Count;
+			uint8_t Sprites[MaxSpritesPerLine];
+		};
+		SpriteLine spriteLines[LCDHeight];
+		int spriteLinesHeight;
+		bool spriteLinesDirty;
+		void BuildSpriteLines(int sprite_height);
+		void SpriteChanged();
+
 		DMATransferRegisters dma;
 		uint16_t dmaSrc;
 		uint16_t dmaDest;
@@ -128,10 +263,14 @@ class GPU
 		LCDStatusRegister stat;
 		MonochromePalette bgMonoPalette;
 		MonochromePalette sprMonoPalettes[2];
+		GemPalette dmgPalette;
 		ColourPalette bgColourPalette;
 		ColourPalette sprColourPalette;
 
-		ColourBuffer frameBuffer;
+		// The frame is kept as packed pixels ready for presenting. The colour number and priority
+		// that sprites are merged against live in a separate plane with one byte per pixel.
+		PixelBuffer frameBuffer;
+		DArray<uint8_t> pixelAttributes;
 		CorrectionMode correctionMode;
 		float brightness;
 
@@ -140,4 +279,5 @@ class GPU
 		std::shared_ptr<IMMU> mmu;
 
 		friend class RewindManager;
+		friend class RenderWorker;
 };
@@ -73,9 +73,8 @@ struct MonochromePalette
 	MonochromePalette();
 	void WriteBgPalette(uint8_t value);
 	uint8_t ReadBgPalette();
-	const GemColour& GetColour(uint8_t colour_number);
+	const GemColour& GetColour(uint8_t colour_number, const GemPalette& shades) const;
 
-	GemColour* PalettePtrs[4];
 	uint8_t BGPalette[4];
 	uint8_t BgPaletteRegisterByte;
 
@@ -149,6 +148,7 @@ struct SpriteData
 	void Reset(bool bCGB);
 	void DecodeFromOAM(uint16_t addr, uint8_t* oam);
 	void DecodeFromOAM(uint16_t addr, uint8_t byte0, uint8_t byte1, uint8_t byte2, uint8_t byte3);
+	bool operator==(const SpriteData& other) const; // Compares the decoded fields that affect rendering
 };
 
 struct DMATransferRegisters
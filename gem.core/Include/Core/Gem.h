@@ -18,7 +18,12 @@ class Gem
 
 		void Reset(bool bCGB);
 		void Shutdown();
+
+		// Creates an independent instance in the same state as this one. The ROM is shared and
+		// WRAM/VRAM/external RAM pages are only copied once either side writes to them.
+		std::shared_ptr<Gem> Fork();
 		void LoadRom(const char* file);
+		void LoadRom(std::shared_ptr<CartridgeReader> rom); // ROM data is read-only so instances can share one reader
 		bool IsROMLoaded() const { return cart.get() != nullptr; }
 		std::shared_ptr<CartridgeReader> GetCartridgeReader() { return cart; }
 
@@ -26,6 +31,7 @@ class Gem
 		void TickUntilVBlank();
 		const uint64_t GetTickCount() const { return tickCount; }
 		const uint64_t GetFrameCount() const { return frameCount; }
+		const uint64_t GetCycleCount() const { return cycleCount; } // CPU T cycles
 		
 		Z80& GetCPU() { return cpu; }
 		std::shared_ptr<GPU> GetGPU() { return gpu; }
@@ -33,7 +39,12 @@ class Gem
 		std::shared_ptr<MMU> GetMMU() { return mmu; }
 		std::shared_ptr<Joypad> GetJoypad() { return joypad; }
 
-		void ToggleSound(bool enabled);
+		void ToggleSound(bool enabled); // Disabled sound keeps the APU's registers running but generates no samples
+
+		// Audio only mode (for GBS playback) doesn't tick the GPU at all. A VBlank interrupt is requested every
+		// frame's worth of cycles instead and the LCD registers keep whatever values they had.
+		void SetAudioOnly(bool enabled);
+		bool IsAudioOnly() const { return audioOnly; }
 
 		std::string StartTrace();
 		void EndTrace();
@@ -44,6 +55,7 @@ class Gem
 	private:
 		uint64_t tickCount;
 		uint64_t frameCount;
+		uint64_t cycleCount;
 		bool bCGB;
 
 		Z80 cpu;
@@ -53,7 +65,14 @@ class Gem
 		std::shared_ptr<APU> apu;
 		std::shared_ptr<Joypad> joypad;
 
-		bool tickAPU;
+		bool audioOnly;
+		int vblankTCycles; // Counts towards the next VBlank in audio only mode
+
+		// Tick() forwards to the DMG or CGB (and video or audio only) specialisation chosen in SelectModePath()
+		typedef bool (Gem::*TickFunc)();
+		TickFunc tickFunc;
+		void SelectModePath();
+		template<bool CGB, bool Video> bool TickMode();
 
 		std::ofstream* traceFile;
 		bool isTracing;
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <memory>
+#include <cstdint>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <exception>
+
+#include "Core/Gem.h"
+#include "DArray.h"
+
+// Runs a batch of jobs on a fixed set of threads. Jobs are dealt round-robin into per-worker queues;
+// a worker pops from the front of its own queue and, once that's empty, steals from the back of the
+// others. The calling thread acts as worker 0 so a pool of N threads only spawns N-1.
+class WorkStealingPool
+{
+	public:
+		WorkStealingPool(int num_threads);
+		~WorkStealingPool();
+
+		// Calls job(i) for i in [0, num_jobs) and returns once every call has finished
+		void Run(int num_jobs, const std::function<void(int)>& job);
+		int NumThreads() const { return numThreads; }
+
+	private:
+		struct WorkQueue
+		{
+			std::mutex Lock;
+			std::deque<int> Jobs;
+		};
+
+		void WorkerLoop(int worker);
+		void DrainQueues(int worker);
+		bool PopJob(int worker, int& job);
+
+		int numThreads;
+		std::vector<std::unique_ptr<WorkQueue>> queues;
+		std::vector<std::thread> threads;
+
+		const std::function<void(int)>* currentJob;
+		std::atomic<int> pendingJobs;
+		std::exception_ptr jobError;
+
+		std::mutex stateLock;
+		std::condition_variable startSignal;
+		std::condition_variable doneSignal;
+		uint64_t generation;
+		bool shutdown;
+};
+
+// Owns a number of Gem instances and steps them in lockstep on a WorkStealingPool. Inputs and outputs
+// for every instance are packed into contiguous arrays (instance i lives at i * stride) so callers
+// can hand them straight to a training loop or compare them across instances.
+class GemBatch
+{
+	public:
+		typedef std::function<float(Gem& gem, int index)> RewardFunc;
+
+		GemBatch(int num_instances, int num_threads = 0); // 0 threads = one per hardware thread
+		~GemBatch();
+
+		void LoadRom(const char* file); // All instances share a single copy of the ROM
+		void LoadRom(int index, const char* file);
+		void Reset(bool bCGB);
+
+		void StepFrames(int frames = 1);
+		void StepCycles(uint64_t t_cycles); // CPU T cycles; leftover from an instruction carries into the next step
+
+		// Only draw one frame in every frames+1, counting from the next one. With StepFrames(frames + 1) the
+		// frame buffers are then drawn on the last frame of each step and the others are emulated undrawn.
+		void SetFrameSkip(int frames);
+
+		int Count() const { return numInstances; }
+		Gem& GetInstance(int index) { return *instances[index]; }
+		WorkStealingPool& GetPool() { return pool; }
+
+		// Copies size bytes starting at addr out of each instance after every step
+		void SetRAMView(uint16_t addr, int size);
+		void SetRewardFunction(RewardFunc func) { rewardFunc = func; }
+
+		// One byte per instance, bit n set = JoypadKey n held. Applied at the start of the next step.
+		uint8_t* GetInputs() { return inputs.Ptr(); }
+
+		const uint8_t* GetFrameBuffers() const { return frameBuffers.Ptr(); } // RGB, FrameBufferStride bytes per instance
+		const uint8_t* GetRAMViews() const { return ramViews.Ptr(); } // GetRAMViewStride() bytes per instance
+		const float* GetRewards() const { return rewards.Ptr(); }
+		int GetRAMViewStride() const { return ramViewSize; }
+
+		static const int FrameBufferStride = GPU::LCDWidth * GPU::LCDHeight * 3;
+
+	private:
+		void ApplyInputs(int index);
+		void CaptureOutputs(int index);
+
+		int numInstances;
+		std::vector<std::shared_ptr<Gem>> instances;
+		std::shared_ptr<CartridgeReader> sharedRom;
+		WorkStealingPool pool;
+
+		DArray<uint8_t> inputs;
+		DArray<uint8_t> appliedInputs;
+		DArray<uint64_t> cycleTargets;
+		DArray<uint8_t> frameBuffers;
+		DArray<uint8_t> ramViews;
+		DArray<float> rewards;
+
+		uint16_t ramViewAddr;
+		int ramViewSize;
+		RewardFunc rewardFunc;
+};
@@ -4,8 +4,8 @@
 namespace GemConstants
 {
 	static const long TClockSpeed = 4'194'304;
-	static const int SampleRate = 44100;
-	static const int TCyclesPerSample = 95;
+	static const int TCyclesPerFrame = 70'224; // 154 lines of 456 cycles
+	static const int SampleRate = 44100; // Requested from the audio device; the APU renders at whatever rate is granted
 	static const int TCyclesPerAPUCycle = 8192; // APU's components are clocked with 512Hz
 	static const int WaveRAMSize = 32;
 	static const int WaveRAMSizeBytes = 16; 
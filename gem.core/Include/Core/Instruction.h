@@ -1,5 +1,6 @@
 #pragma once
-#include <string>
+#include <array>
+#include <cstdint>
 
 enum class Direction
 {
@@ -26,45 +27,6 @@ enum class ShiftType
 ** all CALLs
 */
 
-struct OpCodeInfo
-{
-	OpCodeInfo()
-		: OpCode(0)
-
-	{
-	}
-	
-	OpCodeInfo(uint16_t opcode, std::string enum_name, std::string mnemonic)
-		: EnumName(enum_name)
-		, OpCode(opcode)
-		, Mnemonic(mnemonic)
-	{
-	}
-	std::string EnumName;
-	uint16_t OpCode;
-	std::string Mnemonic;
-};
-
-class OpCodeIndex
-{
-public:
-	OpCodeIndex();
-	~OpCodeIndex();
-
-	bool Lookup(uint16_t opcode, OpCodeInfo& info);
-	bool Contains(uint16_t opcode);
-	int GetImmSize(uint16_t inst);
-
-	OpCodeInfo& operator[](int index);
-
-	static OpCodeIndex& Get();
-
-private:
-	short* usedIndices;
-	short* opcodeToIdxMap;
-	OpCodeInfo* list;
-};
-
 enum OpCode
 {
 	/* Special instruction that redirections to the CBXX instructions */
@@ -689,4 +651,67 @@ enum OpCode
 	XORn = 0xEE, // A <- A ^n
 };
 
-int GetInstructionImmSize(OpCode inst);
+enum class OperandEncoding : uint8_t
+{
+	None = 0,
+	Imm8 = 1,			// n
+	Imm16 = 2,			// nn, low order byte first
+	SignedImm8 = 3,		// Signed n added to SP
+	Relative8 = 4,		// Signed n added to the PC of the next instruction
+	HighPageImm8 = 5,	// FF00 + n
+};
+
+struct OpCodeInfo
+{
+	const char* EnumName;
+	uint16_t OpCode;
+	const char* Mnemonic;
+	uint8_t ImmSize;
+	uint8_t Cycles;			// M cycles, for conditional branches this is when the branch isn't taken
+	uint8_t BranchCycles;	// M cycles when a conditional branch is taken. Same as Cycles for everything else
+	OperandEncoding Operand;
+
+	constexpr bool IsValid() const { return Mnemonic != nullptr; }
+};
+
+// Base opcodes occupy [0x000,0x0FF] of the table and the CB-prefixed ones [0x100,0x1FF]
+static const int OpCodeTableSize = 0x200;
+
+constexpr int GetOpCodeTableIndex(uint16_t opcode)
+{
+	return (opcode & 0xFF00) == 0xCB00 ? 0x100 | (opcode & 0xFF) : (opcode & 0xFF);
+}
+
+constexpr std::array<OpCodeInfo, OpCodeTableSize> BuildOpCodeTable()
+{
+	constexpr OpCodeInfo list[] =
+	{
+#define OPCODE(op,e,mn,imm,cycles,branch_cycles,operand) { e, uint16_t(op), mn, imm, cycles, branch_cycles, OperandEncoding::operand },
+#include "OpcodeTable.inl"
+#undef OPCODE
+	};
+
+	// Unused opcodes are left with a null mnemonic
+	std::array<OpCodeInfo, OpCodeTableSize> table = {};
+	for (const OpCodeInfo& info : list)
+		table[GetOpCodeTableIndex(info.OpCode)] = info;
+
+	return table;
+}
+
+inline constexpr std::array<OpCodeInfo, OpCodeTableSize> OpCodeTable = BuildOpCodeTable();
+
+constexpr const OpCodeInfo& GetOpCodeInfo(uint16_t opcode)
+{
+	return OpCodeTable[GetOpCodeTableIndex(opcode)];
+}
+
+constexpr bool IsValidOpCode(uint16_t opcode)
+{
+	return GetOpCodeInfo(opcode).IsValid();
+}
+
+constexpr int GetInstructionImmSize(uint16_t inst)
+{
+	return GetOpCodeInfo(inst).ImmSize;
+}
@@ -33,6 +33,7 @@ public:
 	void Press(JoypadKey key);
 	void Release(JoypadKey key);
 	void SetInterruptController(std::shared_ptr<InterruptController> ptr);
+	void ForkFrom(const Joypad& parent);
 private:
 	const int GetKeyInt(JoypadKey key) const { return static_cast<int>(key); }
 
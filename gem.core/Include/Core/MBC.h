@@ -6,6 +6,7 @@
 #include <cstdint>
 
 #include "DArray.h"
+#include "CowBuffer.h"
 #include "Core/CartridgeReader.h"
 
 enum class BankingMode
@@ -51,7 +52,7 @@ private:
 	uint16_t extRAMBank;
 	int extRAMOffset;
 	int numExtRAMBanks; // The currently mapped bank
-	DArray<uint8_t> extRAMBanks[4];
+	CowBuffer extRAMBanks[4];
 		
 	// TODO: put RTC in its own class?
 	bool rtcEnabled;
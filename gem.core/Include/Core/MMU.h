@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "DArray.h"
+#include "CowBuffer.h"
 #include "IMappedComponent.h"
 
 #include "Core/GPU.h"
@@ -22,6 +23,7 @@ class MMU : public IMMU, public std::enable_shared_from_this<MMU>
 	public:
 		MMU();
 		void Reset(bool bCGB);
+		void ForkFrom(const MMU& parent); // WRAM and external RAM are shared copy-on-write with the parent
 		bool SetCartridge(std::shared_ptr<CartridgeReader> ptr);
 
 		virtual uint8_t ReadByte(uint16_t addr) override;
@@ -57,6 +59,16 @@ class MMU : public IMMU, public std::enable_shared_from_this<MMU>
 	private:
 		bool bCGB;
 
+		// Working RAM banking differs between DMG and CGB, the accessors are picked in SelectModePath()
+		typedef uint8_t (MMU::*ReadWorkingRamFunc)(uint16_t, bool);
+		typedef void (MMU::*WriteWorkingRamFunc)(uint16_t, bool, uint8_t);
+		ReadWorkingRamFunc readWorkingRam;
+		WriteWorkingRamFunc writeWorkingRam;
+		void SelectModePath();
+
+		template<bool CGB> uint8_t ReadWorkingRam(uint16_t addr, bool bank0);
+		template<bool CGB> void WriteWorkingRam(uint16_t addr, bool bank0, uint8_t value);
+
 		std::vector<Breakpoint>* writeBreakpoints;
 		std::vector<Breakpoint>* readBreakpoints;
 		bool evalBreakpoints;
@@ -72,7 +84,7 @@ class MMU : public IMMU, public std::enable_shared_from_this<MMU>
 		std::shared_ptr<APU> apu;
 		std::shared_ptr<Joypad> joypad;
 
-		DArray<uint8_t> wramBanks[8];
+		CowBuffer wramBanks[8];
 		uint8_t hram[128];
 
 		friend class RewindManager;
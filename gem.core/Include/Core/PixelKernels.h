@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+
+// Scanline compositing kernels over the packed frame buffer and its attribute plane. Each one has a
+// scalar, an SSE2 and an AVX2 version; the widest the CPU supports is picked at startup.
+namespace PixelKernels
+{
+	enum class Level
+	{
+		Scalar,
+		SSE2,
+		AVX2
+	};
+
+	// Writes shades[colour number] and (colour number | priority) for a run of BG/window pixels
+	typedef void (*CompositeFunc)(uint32_t* dest, uint8_t* dest_attrs, const uint8_t* pixels, int count, const uint32_t* shades, uint8_t priority);
+
+	// Merges a run of sprite pixels over what's already on the line, following the BG priority rules.
+	// 'force' ignores the sprite's behind-BG flag, leaving only BG tiles with CGB priority on top.
+	typedef void (*MergeSpriteFunc)(uint32_t* dest, uint8_t* dest_attrs, const uint8_t* pixels, int count, const uint32_t* shades, bool behind_bg, bool force);
+
+	struct KernelSet
+	{
+		Level KernelLevel;
+		CompositeFunc Composite;
+		MergeSpriteFunc MergeSprite;
+	};
+
+	const KernelSet& Get();
+
+	Level GetSupportedLevel();
+	void SetLevel(Level level); // Clamped to what the CPU supports, mostly for comparing the kernels
+	const char* GetLevelName(Level level);
+}
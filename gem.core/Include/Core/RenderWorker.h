@@ -0,0 +1,74 @@
+#pragma once
+
+#include <memory>
+#include <cstdint>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "Core/GPURegisters.h"
+#include "Colour.h"
+
+class GPU;
+
+// Renders a GPU's lines on a separate thread. The GPU logs every VRAM, OAM and CGB palette write into the
+// job for the line being emulated and submits it with the line's registers at the end of mode 3. The worker
+// keeps its own copy of the video state (a GPU that never ticks), replays each job's writes into it and then
+// renders the line, so emulation can run up to MaxLinesInFlight lines ahead of the pixels.
+class RenderWorker
+{
+	public:
+		enum class WriteTarget : uint8_t
+		{
+			VRAM, // Index into VRAM, both banks
+			OAM, // Offset into OAM
+			Register // CGB palette register address
+		};
+
+		RenderWorker(const GPU& source);
+		~RenderWorker();
+
+		void LogWrite(WriteTarget target, uint16_t index, uint8_t value)
+		{
+			jobs[submitted % MaxLinesInFlight].Writes.push_back({ target, value, index });
+		}
+
+		void SubmitLine(const GPU& source);
+		void CopyFrame(GPU& dest); // Waits for every submitted line, then copies the frame buffer and pixel attributes
+		void Sync(const GPU& source); // Waits for every submitted line, then takes a copy of the source's state (unsubmitted writes included)
+
+		static const int MaxLinesInFlight = 16;
+
+	private:
+		struct VideoWrite
+		{
+			WriteTarget Target;
+			uint8_t Value;
+			uint16_t Index;
+		};
+
+		struct LineJob
+		{
+			LCDControlRegister Control;
+			LCDPositions Positions;
+			MonochromePalette BgMonoPalette;
+			MonochromePalette SprMonoPalettes[2];
+			std::vector<VideoWrite> Writes;
+		};
+
+		void WorkerLoop();
+		void RenderJob(LineJob& job);
+		void WaitForIdle(std::unique_lock<std::mutex>& guard);
+
+		std::unique_ptr<GPU> renderer;
+		LineJob jobs[MaxLinesInFlight];
+		uint64_t submitted; // Only the emulation thread changes this, always with the lock held
+		uint64_t completed;
+		bool shutdown;
+
+		std::mutex stateLock;
+		std::condition_variable jobSignal;
+		std::condition_variable doneSignal;
+		std::thread thread;
+};
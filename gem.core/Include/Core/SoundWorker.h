@@ -0,0 +1,64 @@
+#pragma once
+
+#include <memory>
+#include <cstdint>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "Core/APU.h"
+
+// Synthesises an APU's output on a separate thread. The emulation thread's APU logs every register and wave
+// RAM write with the cycle it was made on and publishes how far it has been ticked every PublishInterval
+// cycles. The worker keeps its own APU, ticks it up to each write's cycle, applies the write and carries on
+// up to the published cycle, so the samples it writes into the audio ring are the same as an unthreaded APU's.
+class SoundWorker
+{
+	public:
+		SoundWorker(const APU& source);
+		~SoundWorker();
+
+		// Only called from the emulation thread. The log is a single producer/single consumer ring, so
+		// this only waits when MaxWritesInFlight writes haven't been applied yet.
+		void LogWrite(uint64_t cycle, uint16_t addr, uint8_t value);
+		void Publish(uint64_t cycle); // Lets the worker synthesise up to (but not including) this cycle
+		void SetRateAdjustment(float ratio) { rateAdjustment = ratio; }
+
+		void Finish(uint64_t cycle); // Publishes the cycle and waits for the worker to catch up to it
+		void Sync(const APU& source); // Waits for the worker to finish, then takes a copy of the source's state and cycle
+		APU& Synthesiser() { return *synth; } // Only safe to use between Finish() and the next Publish()
+		EmittersSnapshot Snapshot();
+
+		static const int MaxWritesInFlight = 4096;
+		static const int PublishInterval = 4096;
+
+	private:
+		struct SoundWrite
+		{
+			uint64_t Cycle;
+			uint16_t Address;
+			uint8_t Value;
+		};
+
+		void WorkerLoop();
+		void CatchUp(uint64_t target);
+		void TickTo(uint64_t cycle);
+		bool IsIdle() const;
+		bool HasWork() const;
+
+		std::unique_ptr<APU> synth;
+		std::atomic<uint64_t> synthCycle; // Only the worker changes this while it's running
+		SoundWrite writes[MaxWritesInFlight];
+		std::atomic<uint64_t> logged; // Only the emulation thread changes this
+		std::atomic<uint64_t> applied; // Only the worker changes this
+		std::atomic<uint64_t> published;
+		std::atomic<float> rateAdjustment;
+		EmittersSnapshot snapshot;
+		bool shutdown;
+
+		std::mutex stateLock;
+		std::condition_variable workSignal;
+		std::condition_variable doneSignal;
+		std::thread thread;
+};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <climits>
 #include <memory>
 
 #include "Core/InterruptController.h"
@@ -24,6 +25,7 @@ public:
 	uint8_t ReadByte(uint16_t addr) const;
 	void TickTimers(int t_cycles);
 	int GetCounterFrequency();
+	int TCyclesUntilOverflow() const { return Running ? int(0x100 - Counter) * int(tCyclesPerCtrCycle) - ctrAcc : INT_MAX; }
 
 private:
 	std::shared_ptr<InterruptController> interrupts;
@@ -31,6 +31,7 @@ class Z80
 	public: 
 		Z80();
 		void Reset(bool bCGB);
+		void ForkFrom(const Z80& parent); // Copies the parent's state but keeps this CPU's MMU
 		int Execute(uint16_t inst);
 
 		void SetMMU(std::shared_ptr<MMU> ptr);
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+#include <atomic>
+
+#include "DArray.h"
+
+// A fixed size byte buffer made up of 4kB pages that can be shared between emulator instances.
+// Copying a CowBuffer doesn't copy any memory, both buffers point at the same pages and whichever
+// one writes to a page first gets its own copy of it. Reads cost one extra indirection compared
+// to a DArray. Like the rest of the core, a buffer (and its copies) must not be copied from
+// while another thread is writing to it.
+class CowBuffer
+{
+public:
+	static const int PageShift = 12;
+	static const int PageSize = 1 << PageShift;
+	static const int PageMask = PageSize - 1;
+
+	CowBuffer()
+		: size(0)
+	{
+	}
+
+	CowBuffer(uint32_t size, bool allocate_now = false)
+		: size(size)
+	{
+		CHECK((size & PageMask) == 0, "CowBuffer size must be a multiple of the page size");
+
+		if (allocate_now)
+			Allocate();
+	}
+
+	CowBuffer(const CowBuffer& other)
+	{
+		Share(other);
+	}
+
+	CowBuffer& operator=(const CowBuffer& other)
+	{
+		if (this != &other)
+			Share(other);
+
+		return *this;
+	}
+
+	CowBuffer(CowBuffer&& other) = default;
+	CowBuffer& operator=(CowBuffer&& other) = default;
+
+	// Allocates every page up front and zeroes it
+	void Allocate()
+	{
+		CHECK(pages.empty(), "Memory already allocated");
+		CHECK(size > 0, "Allocation size must be greater than 0");
+
+		int num_pages = size >> PageShift;
+		pages.resize(num_pages);
+		writable.resize(num_pages);
+
+		for (int i = 0; i < num_pages; i++)
+		{
+			pages[i] = std::shared_ptr<uint8_t[]>(new uint8_t[PageSize]);
+			writable[i] = pages[i].get();
+			memset(writable[i], 0, PageSize);
+		}
+	}
+
+	uint8_t operator[](uint32_t index) const
+	{
+		CHECK(index < size && !pages.empty(), "Index out of range");
+		return pages[index >> PageShift][index & PageMask];
+	}
+
+	void Write(uint32_t index, uint8_t value)
+	{
+		CHECK(index < size && !pages.empty(), "Index out of range");
+
+		uint8_t* page = writable[index >> PageShift];
+		if (page == nullptr)
+			page = Unshare(index >> PageShift);
+
+		page[index & PageMask] = value;
+	}
+
+	void Fill(uint8_t value)
+	{
+		for (int i = 0; i < NumPages(); i++)
+			memset(WritablePage(i), value, PageSize);
+	}
+
+	void CopyTo(uint8_t* dest) const
+	{
+		for (int i = 0; i < NumPages(); i++)
+			memcpy(dest + i * PageSize, pages[i].get(), PageSize);
+	}
+
+	void CopyFrom(const uint8_t* src)
+	{
+		for (int i = 0; i < NumPages(); i++)
+			memcpy(WritablePage(i), src + i * PageSize, PageSize);
+	}
+
+	const uint8_t* Page(int page) const { return pages[page].get(); }
+	uint8_t* WritablePage(int page) { return writable[page] ? writable[page] : Unshare(page); }
+	bool IsPageShared(int page) const { return writable[page] == nullptr; }
+
+	bool IsAllocated() const { return !pages.empty(); }
+	int NumPages() const { return int(pages.size()); }
+	uint32_t Size() const { return size; }
+
+private:
+	void Share(const CowBuffer& other)
+	{
+		size = other.size;
+		pages = other.pages;
+
+		// Neither side may write in place from now on
+		writable.assign(pages.size(), nullptr);
+		other.writable.assign(other.pages.size(), nullptr);
+	}
+
+	uint8_t* Unshare(int page)
+	{
+		if (pages[page].use_count() == 1)
+		{
+			// Whoever shared it has since copied or released it. use_count() is a relaxed read so
+			// make sure their last accesses to the page are visible before we start writing.
+			std::atomic_thread_fence(std::memory_order_acquire);
+		}
+		else
+		{
+			std::shared_ptr<uint8_t[]> copy(new uint8_t[PageSize]);
+			memcpy(copy.get(), pages[page].get(), PageSize);
+			pages[page] = copy;
+		}
+
+		writable[page] = pages[page].get();
+		return writable[page];
+	}
+
+	uint32_t size;
+	std::vector<std::shared_ptr<uint8_t[]>> pages;
+	mutable std::vector<uint8_t*> writable; // nullptr where the page is shared with another buffer
+};
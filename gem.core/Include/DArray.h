@@ -50,12 +50,11 @@ public:
 	}
 
 	DArray(const DArray& other)
+		: pData(nullptr)
+		, numElements(0)
+		, numSpots(0)
 	{
-		pData = (T*)malloc(other.Size());
-		CHECK(pData != nullptr, "Could not allocate memory for DArray");
-		
-		memcpy(pData, other.pData, other.Size());
-		numSpots = other.numSpots;
+		CopyFrom(other);
 	}
 
 	DArray(DArray&& other)
@@ -70,15 +69,17 @@ public:
 
 	DArray& operator=(const DArray& other)
 	{
-		pData = (T*)malloc(other.Size());
-		CHECK(pData != nullptr, "Could not allocate memory for DArray");
-		
-		memcpy(pData, other.pData, other.Size());
-		numSpots = other.numSpots;
+		if (this != &other)
+			CopyFrom(other);
+
+		return *this;
 	}
 
 	DArray& operator=(DArray&& other)
 	{
+		if (pData != nullptr)
+			delete[] pData;
+
 		pData = other.pData;
 		numSpots = other.numSpots;
 		numElements = other.numElements;
@@ -88,6 +89,23 @@ public:
 		return *this;
 	}
 
+	// Deep copy, an unallocated array stays unallocated
+	void CopyFrom(const DArray& other)
+	{
+		if (pData != nullptr)
+			delete[] pData;
+
+		pData = nullptr;
+		numSpots = other.numSpots;
+		numElements = other.numElements;
+
+		if (other.pData != nullptr)
+		{
+			pData = new T[numSpots];
+			std::copy(other.pData, other.pData + numSpots, pData);
+		}
+	}
+
 	void Swap(DArray& other)
 	{
 		T* temp_pData = pData;
@@ -1,11 +0,0 @@
-
-#pragma once
-
-#include "DArray.h"
-
-class IAudioQueue
-{
-	public:
-		virtual int GetQueuedSampleCount() = 0;
-		virtual void PushAudioData(const DArray<float>& buffer) = 0;
-};
\ No newline at end of file
@@ -0,0 +1,240 @@
+#include <algorithm>
+#include <chrono>
+
+#include "AudioCapture.h"
+#include "Logging.h"
+
+using namespace std;
+
+AudioCapture::AudioCapture()
+	: capturing(false)
+	, withStems(false)
+	, sampleRate(0)
+	, channels(2)
+	, capacity(0)
+	, mask(0)
+	, writePos(0)
+	, readPos(0)
+	, droppedFrames(0)
+	, stopRequested(false)
+{
+}
+
+AudioCapture::~AudioCapture()
+{
+	Stop();
+}
+
+bool AudioCapture::Start(const string& path, int sample_rate, bool stems)
+{
+	Stop();
+
+	mixFile.open(path, ios::out | ios::binary | ios::trunc);
+	if (!mixFile.is_open())
+	{
+		LOG_ERROR("Could not open %s for the audio capture", path.c_str());
+		return false;
+	}
+
+	if (stems)
+	{
+		size_t dot = path.find_last_of('.');
+		size_t slash = path.find_last_of("/\\");
+		if (dot == string::npos || (slash != string::npos && dot < slash))
+			dot = path.length();
+
+		for (int i = 0; i < StemCount; i++)
+		{
+			string stem_path = path.substr(0, dot) + "_ch" + to_string(i + 1) + path.substr(dot);
+			stemFiles[i].open(stem_path, ios::out | ios::binary | ios::trunc);
+
+			if (!stemFiles[i].is_open())
+			{
+				LOG_ERROR("Could not open %s for the audio capture", stem_path.c_str());
+
+				mixFile.close();
+				for (int j = 0; j < i; j++)
+					stemFiles[j].close();
+
+				return false;
+			}
+		}
+	}
+
+	withStems = stems;
+	sampleRate = sample_rate;
+	channels = stems ? 2 + StemCount : 2;
+
+	capacity = 1;
+	while (capacity < uint64_t(sample_rate) * BufferSeconds)
+		capacity <<= 1;
+
+	mask = capacity - 1;
+	samples.assign(capacity * channels, 0.0f);
+	writePos = 0;
+	readPos = 0;
+	droppedFrames = 0;
+
+	// The sizes are filled in when the capture stops
+	WriteHeader(mixFile, 2, 0);
+	for (int i = 0; withStems && i < StemCount; i++)
+		WriteHeader(stemFiles[i], 1, 0);
+
+	stopRequested = false;
+	capturing = true;
+	writer = std::thread(&AudioCapture::WriterLoop, this);
+
+	LOG_INFO("Capturing audio to %s at %dHz%s", path.c_str(), sample_rate, stems ? " with channel stems" : "");
+	return true;
+}
+
+void AudioCapture::Stop()
+{
+	if (!capturing)
+		return;
+
+	{
+		lock_guard<mutex> guard(stateLock);
+		stopRequested = true;
+	}
+
+	wakeSignal.notify_all();
+	writer.join();
+
+	uint32_t frames = uint32_t(readPos.load());
+
+	mixFile.seekp(0);
+	WriteHeader(mixFile, 2, frames);
+	mixFile.close();
+
+	for (int i = 0; withStems && i < StemCount; i++)
+	{
+		stemFiles[i].seekp(0);
+		WriteHeader(stemFiles[i], 1, frames);
+		stemFiles[i].close();
+	}
+
+	if (droppedFrames > 0)
+		LOG_WARN("The audio capture fell behind and dropped %u frames", droppedFrames.load());
+
+	LOG_INFO("Audio capture finished after %u frames", frames);
+	capturing = false;
+}
+
+void AudioCapture::Write(const float* mix_frames, const float* stem_frames, int frame_count)
+{
+	uint64_t write = writePos.load(memory_order_relaxed);
+	uint64_t read = readPos.load(memory_order_acquire);
+
+	int free_frames = int(capacity - (write - read));
+	if (frame_count > free_frames)
+	{
+		droppedFrames.fetch_add(frame_count - free_frames, memory_order_relaxed);
+		frame_count = free_frames;
+	}
+
+	for (int i = 0; i < frame_count; i++, write++)
+	{
+		float* frame = &samples[(write & mask) * channels];
+		frame[0] = mix_frames[i * 2];
+		frame[1] = mix_frames[i * 2 + 1];
+
+		for (int s = 0; withStems && s < StemCount; s++)
+			frame[2 + s] = stem_frames[i * StemCount + s];
+	}
+
+	writePos.store(write, memory_order_release);
+
+	// Without the lock this can be missed, the writer's timeout covers that
+	if (QueuedFrames() >= capacity / 4)
+		wakeSignal.notify_one();
+}
+
+void AudioCapture::WriterLoop()
+{
+	unique_lock<mutex> guard(stateLock);
+
+	while (true)
+	{
+		wakeSignal.wait_for(guard, chrono::milliseconds(100), [this] { return stopRequested || QueuedFrames() >= capacity / 4; });
+		bool stopping = stopRequested;
+
+		guard.unlock();
+		Drain();
+		guard.lock();
+
+		if (stopping)
+			return;
+	}
+}
+
+void AudioCapture::Drain()
+{
+	uint64_t read = readPos.load(memory_order_relaxed);
+	uint64_t write = writePos.load(memory_order_acquire);
+
+	while (read != write)
+	{
+		// Up to the end of the ring in one go
+		uint64_t index = read & mask;
+		uint64_t count = min(write - read, capacity - index);
+		const float* frames = &samples[index * channels];
+
+		if (!withStems)
+		{
+			mixFile.write(reinterpret_cast<const char*>(frames), count * 2 * sizeof(float));
+		}
+		else
+		{
+			stemScratch.resize(count * 2);
+			for (uint64_t i = 0; i < count; i++)
+			{
+				stemScratch[i * 2] = frames[i * channels];
+				stemScratch[i * 2 + 1] = frames[i * channels + 1];
+			}
+
+			mixFile.write(reinterpret_cast<const char*>(stemScratch.data()), count * 2 * sizeof(float));
+
+			for (int s = 0; s < StemCount; s++)
+			{
+				for (uint64_t i = 0; i < count; i++)
+					stemScratch[i] = frames[i * channels + 2 + s];
+
+				stemFiles[s].write(reinterpret_cast<const char*>(stemScratch.data()), count * sizeof(float));
+			}
+		}
+
+		read += count;
+		readPos.store(read, memory_order_release);
+	}
+}
+
+void AudioCapture::WriteHeader(ofstream& file, int channel_count, uint32_t frame_count)
+{
+	// WAVE_FORMAT_IEEE_FLOAT, which also needs a fact chunk
+	uint32_t data_size = frame_count * channel_count * sizeof(float);
+
+	auto write_u32 = [&file](uint32_t value) { file.write(reinterpret_cast<const char*>(&value), 4); };
+	auto write_u16 = [&file](uint16_t value) { file.write(reinterpret_cast<const char*>(&value), 2); };
+
+	file.write("RIFF", 4);
+	write_u32(4 + (8 + 18) + (8 + 4) + (8 + data_size));
+	file.write("WAVE", 4);
+
+	file.write("fmt ", 4);
+	write_u32(18);
+	write_u16(3);
+	write_u16(uint16_t(channel_count));
+	write_u32(uint32_t(sampleRate));
+	write_u32(uint32_t(sampleRate * channel_count * sizeof(float)));
+	write_u16(uint16_t(channel_count * sizeof(float)));
+	write_u16(32);
+	write_u16(0);
+
+	file.write("fact", 4);
+	write_u32(4);
+	write_u32(frame_count);
+
+	file.write("data", 4);
+	write_u32(data_size);
+}
@@ -0,0 +1,143 @@
+#include <algorithm>
+
+#include "AudioRing.h"
+
+using namespace std;
+using namespace std::chrono;
+
+AudioHistogram::AudioHistogram(float bucket_ms)
+	: bucketWidth(bucket_ms)
+{
+	Reset();
+}
+
+void AudioHistogram::Add(float ms)
+{
+	int bucket = min(int(ms / bucketWidth), BucketCount - 1);
+	counts[bucket].fetch_add(1, memory_order_relaxed);
+	total.fetch_add(1, memory_order_relaxed);
+
+	// Only the recording thread stores these
+	sum.store(sum.load(memory_order_relaxed) + ms, memory_order_relaxed);
+	if (ms > maxValue.load(memory_order_relaxed))
+		maxValue.store(ms, memory_order_relaxed);
+}
+
+void AudioHistogram::Reset()
+{
+	for (int i = 0; i < BucketCount; i++)
+		counts[i].store(0, memory_order_relaxed);
+
+	total.store(0, memory_order_relaxed);
+	sum.store(0, memory_order_relaxed);
+	maxValue.store(0, memory_order_relaxed);
+}
+
+float AudioHistogram::Mean() const
+{
+	uint32_t count = Total();
+	return count > 0 ? sum.load(memory_order_relaxed) / count : 0.0f;
+}
+
+AudioRing::AudioRing(int capacity_frames)
+	: writePos(0)
+	, readPos(0)
+	, underruns(0)
+	, paddedFrames(0)
+	, overruns(0)
+	, sampleRate(0)
+	, fillAtWrite(10.0f)
+	, writeInterval(5.0f)
+	, lastLeft(0)
+	, lastRight(0)
+{
+	capacity = 1;
+	while (capacity < uint32_t(capacity_frames))
+		capacity <<= 1;
+
+	mask = capacity - 1;
+	samples.assign(capacity * 2, 0.0f);
+}
+
+int AudioRing::Write(const float* frames, int frame_count)
+{
+	uint32_t write = writePos.load(memory_order_relaxed);
+	uint32_t read = readPos.load(memory_order_acquire);
+
+	if (sampleRate > 0)
+	{
+		fillAtWrite.Add(float(write - read) * 1000 / sampleRate);
+
+		steady_clock::time_point now = steady_clock::now();
+		if (lastWrite.time_since_epoch().count() != 0)
+			writeInterval.Add(duration<float, milli>(now - lastWrite).count());
+
+		lastWrite = now;
+	}
+
+	int free_frames = int(capacity - (write - read));
+	if (frame_count > free_frames)
+	{
+		overruns.fetch_add(1, memory_order_relaxed);
+		frame_count = free_frames;
+	}
+
+	for (int i = 0; i < frame_count; i++, write++)
+	{
+		samples[(write & mask) * 2] = frames[i * 2];
+		samples[(write & mask) * 2 + 1] = frames[i * 2 + 1];
+	}
+
+	writePos.store(write, memory_order_release);
+	return frame_count;
+}
+
+int AudioRing::Read(float* dest, int frame_count)
+{
+	uint32_t read = readPos.load(memory_order_relaxed);
+	uint32_t write = writePos.load(memory_order_acquire);
+
+	int available = min(int(write - read), frame_count);
+	for (int i = 0; i < available; i++, read++)
+	{
+		dest[i * 2] = samples[(read & mask) * 2];
+		dest[i * 2 + 1] = samples[(read & mask) * 2 + 1];
+	}
+
+	readPos.store(read, memory_order_release);
+
+	if (available > 0)
+	{
+		lastLeft = dest[(available - 1) * 2];
+		lastRight = dest[(available - 1) * 2 + 1];
+	}
+
+	if (available < frame_count)
+	{
+		underruns.fetch_add(1, memory_order_relaxed);
+		paddedFrames.fetch_add(frame_count - available, memory_order_relaxed);
+
+		for (int i = available; i < frame_count; i++)
+		{
+			dest[i * 2] = lastLeft;
+			dest[i * 2 + 1] = lastRight;
+		}
+	}
+
+	return available;
+}
+
+void AudioRing::Clear()
+{
+	readPos.store(writePos.load(memory_order_acquire), memory_order_release);
+}
+
+void AudioRing::ResetCounters()
+{
+	underruns.store(0, memory_order_relaxed);
+	paddedFrames.store(0, memory_order_relaxed);
+	overruns.store(0, memory_order_relaxed);
+
+	fillAtWrite.Reset();
+	writeInterval.Reset();
+}
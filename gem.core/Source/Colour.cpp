@@ -81,109 +81,118 @@ void GemColour::Correct(CorrectionMode mode, float brightness)
 #undef MIN
 }
 
-// This helper function accounts for some extra rules when it comes to rendering sprites
-// in relation to the BG.
-// 1. Sprite pixels with colour 0 are invisible.
-// 2. In CGB mode BG tiles can have absolute priority over sprites
-// 3. Sprites can be above or behind the BG. If they are behind the BG, they will still 
-//    appear above BG pixels that were coloured with 0.
-// 4. Colour 0 is always painted over by a sprite
-bool GemColour::ReplaceWithSpritePixel(const GemColour& replace_with, int colour_number, bool behind_bg, bool force)
-{
-	if (colour_number == 0 || (Priority && ColourNumber != 0))
-		return false;
-
-	if (force || (behind_bg && ColourNumber == 0) || !behind_bg)
+uint32_t GemColour::Pack(PixelFormat format) const
+{
+	uint8_t bytes[4];
+	if (format == PixelFormat::BGRA)
+	{
+		bytes[0] = Blue;
+		bytes[1] = Green;
+		bytes[2] = Red;
+	}
+	else
 	{
-		Red = replace_with.Red;
-		Green = replace_with.Green;
-		Blue = replace_with.Blue;
-		ColourNumber = colour_number;
-		return true;
+		bytes[0] = Red;
+		bytes[1] = Green;
+		bytes[2] = Blue;
 	}
+	bytes[3] = Alpha;
 
-	return false;
+	uint32_t pixel;
+	memcpy(&pixel, bytes, sizeof(pixel));
+	return pixel;
+}
+
+GemColour GemColour::Unpack(uint32_t pixel, PixelFormat format)
+{
+	uint8_t bytes[4];
+	memcpy(bytes, &pixel, sizeof(pixel));
+
+	GemColour colour;
+	if (format == PixelFormat::BGRA)
+	{
+		colour.Blue = bytes[0];
+		colour.Red = bytes[2];
+	}
+	else
+	{
+		colour.Red = bytes[0];
+		colour.Blue = bytes[2];
+	}
+	colour.Green = bytes[1];
+	colour.Alpha = bytes[3];
+	return colour;
 }
 
 /////////////////////////////////
 ///      Colour Palette       ///
 /////////////////////////////////
-GemColour* GemPalette::_Black = nullptr;
-GemColour* GemPalette::_DarkGrey = nullptr;
-GemColour* GemPalette::_LightGrey = nullptr;
-GemColour* GemPalette::_White = nullptr;
+GemPalette::GemPalette()
+{
+	ReAssign(0, White());
+	ReAssign(1, LightGrey());
+	ReAssign(2, DarkGrey());
+	ReAssign(3, Black());
+}
 
 void GemPalette::ReAssign(int colour_number, const GemColour& colour)
 {
-	switch (colour_number)
-	{
-	case 0:
-		*_White = colour;
-		_White->ColourNumber = colour_number;
-		break;
-	case 1:
-		*_LightGrey = colour;
-		_LightGrey->ColourNumber = colour_number;
-		break;
-	case 2:
-		*_DarkGrey = colour;
-		_DarkGrey->ColourNumber = colour_number;
-		break;
-	case 3:
-		*_Black = colour;
-		_Black->ColourNumber = colour_number;
-		break;
-	}
+	if (colour_number < 0 || colour_number > 3)
+		return;
+
+	colours[colour_number] = colour;
+	colours[colour_number].ColourNumber = colour_number;
 }
 
 /////////////////////////////////
-///       Colour Buffer       ///
+///       Pixel Buffer        ///
 /////////////////////////////////
 
-ColourBuffer::ColourBuffer()
-	: DArray<GemColour>()
+PixelBuffer::PixelBuffer()
+	: DArray<uint32_t>()
 	, Width(0)
 	, Height(0)
+	, Format(PixelFormat::BGRA)
 {
-
 }
 
-ColourBuffer::ColourBuffer(int w, int h)
-	: DArray<GemColour>(w * h, true)
+PixelBuffer::PixelBuffer(int w, int h, PixelFormat format)
+	: DArray<uint32_t>(w * h, true)
 	, Width(w)
 	, Height(h)
+	, Format(format)
 {
 }
 
-void ColourBuffer::CorrectPixel(int x, int y, CorrectionMode mode)
+GemColour PixelBuffer::GetPixel(int x, int y) const
 {
 	int index = (y * Width) + x;
-	pData[index].Correct(mode, 1.0);
+	return GemColour::Unpack(pData[index], Format);
 }
 
-GemColour ColourBuffer::GetPixel(int x, int y) const
+void PixelBuffer::SetPixel(int x, int y, const GemColour& colour)
 {
 	int index = (y * Width) + x;
-	return pData[index];
+	pData[index] = colour.Pack(Format);
 }
 
-void ColourBuffer::SetPixel(int x, int y, const GemColour& Colour)
+void PixelBuffer::Fill(const GemColour& colour)
 {
-	int index = (y * Width) + x;
-	pData[index] = Colour;
+	DArray<uint32_t>::Fill(colour.Pack(Format));
 }
 
-const GemColour* ColourBuffer::Copy(GemColour* dest) const
+void PixelBuffer::Convert(PixelFormat format)
 {
-	if (dest == nullptr)
-	{
-		dest = new GemColour[numElements];
-	}
-	memcpy(dest, pData, numElements * sizeof(GemColour));
-	return dest;
+	if (format == Format)
+		return;
+
+	for (uint32_t i = 0; i < numElements; i++)
+		pData[i] = GemColour::Unpack(pData[i], Format).Pack(format);
+
+	Format = format;
 }
 
-void ColourBuffer::Zero()
+void PixelBuffer::Zero()
 {
 	memset(pData, 0, Size());
-}
\ No newline at end of file
+}
@@ -1,31 +1,34 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 
 #include "Core/APU.h"
+#include "Core/SoundWorker.h"
 #include "Core/Z80.h"
 #include "Logging.h"
 
 using namespace std;
 
 APU::APU()
-	: buffer(8192)
-	, audioQueue(nullptr)
+	: audioRing(nullptr)
+	, capture(nullptr)
 	, emitter1(1)
 	, emitter2(2)
-	, emitter3(3, waveRAM)
+	, emitter3(3, waveSamples)
 	, emitter4(4)
-	, sampleTAcc(0)
+	, sequencerTAcc(0)
+	, sequencerStep(0)
 	, mute(false)
+	, silent(false)
+	, emulatedCycles(0)
+	, publishedCycles(0)
 {
-	buffer.Allocate();
-
 	memset(waveRAM, 0, sizeof(uint8_t) * GemConstants::WaveRAMSizeBytes);
+	memset(waveSamples, 0, sizeof(uint8_t) * GemConstants::WaveRAMSize);
 
-	chan1.SetEmitter(&emitter1);
-	chan2.SetEmitter(&emitter2);
-	chan3.SetEmitter(&emitter3);
-	chan4.SetEmitter(&emitter4);
+	LinkEmitters();
+	SetSampleRate(GemConstants::SampleRate);
 
 	chanMask[0] = 1;
 	chanMask[1] = 1;
@@ -39,131 +42,472 @@ void APU::Reset()
 	// TODO: reset the register values (probably not noticeable since sound channels are constantly resetting
 }
 
-void APU::SetAudioQueue(IAudioQueue* queue)
+void APU::ForkFrom(const APU& parent)
+{
+	AudioRing* own_ring = audioRing;
+	AudioCapture* own_capture = capture;
+	shared_ptr<SoundWorker> own_worker = soundWorker;
+	uint64_t own_cycles = emulatedCycles;
+	bool parent_silent = parent.silent;
+
+	FinishSynthesis();
+
+	// A threaded parent's channels only advance on its worker (unless it's silent)
+	if (parent.soundWorker && !parent.silent)
+	{
+		parent.soundWorker->Finish(parent.emulatedCycles);
+		*this = parent.soundWorker->Synthesiser();
+	}
+	else
+	{
+		*this = parent;
+	}
+
+	audioRing = own_ring;
+	capture = own_capture;
+	soundWorker = own_worker;
+	silent = parent_silent;
+	emulatedCycles = own_cycles;
+	publishedCycles = own_cycles;
+	LinkEmitters();
+	ClearBuffer();
+
+	if (soundWorker)
+		soundWorker->Sync(*this);
+}
+
+void APU::SetSilent(bool enabled)
+{
+	if (enabled == silent)
+		return;
+
+	// Writes stop being logged while silent, so the worker picks up from this APU's registers afterwards.
+	// The channels' waveform positions went stale with nothing advancing them but are never heard that way.
+	FinishSynthesis();
+	silent = enabled;
+
+	if (!silent)
+	{
+		ClearBuffer();
+
+		if (soundWorker)
+		{
+			soundWorker->Sync(*this);
+			publishedCycles = emulatedCycles;
+		}
+	}
+}
+
+void APU::SetThreaded(bool enabled)
+{
+	if (enabled == IsThreaded())
+		return;
+
+	if (enabled)
+	{
+		soundWorker = make_shared<SoundWorker>(*this);
+		publishedCycles = emulatedCycles;
+	}
+	else
+	{
+		// Take the channels back from the worker before it goes
+		FinishSynthesis();
+		shared_ptr<SoundWorker> worker = soundWorker;
+		uint64_t cycles = emulatedCycles;
+
+		if (!silent)
+			*this = worker->Synthesiser();
+
+		soundWorker = nullptr;
+		emulatedCycles = cycles;
+		publishedCycles = cycles;
+		LinkEmitters();
+	}
+}
+
+void APU::FinishSynthesis()
+{
+	if (soundWorker)
+	{
+		// Nothing new is published while silent
+		if (!silent)
+			publishedCycles = emulatedCycles;
+
+		soundWorker->Finish(publishedCycles);
+	}
+}
+
+void APU::Flush()
 {
-	audioQueue = queue;
+	FinishSynthesis();
 }
 
-void MixSamples(float& dest, float src, float volume)
+void APU::LinkEmitters()
 {
-	// TODO: what to do when all 4 channels are at full level? Then the mixed sum could be at most 4
-	src = src * volume;
-	dest = min(dest + src, FLT_MAX);
+	emitter3.waveSamples = waveSamples;
+
+	chan1.SetEmitter(&emitter1);
+	chan2.SetEmitter(&emitter2);
+	chan3.SetEmitter(&emitter3);
+	chan4.SetEmitter(&emitter4);
+}
+
+void APU::SetAudioRing(AudioRing* ring)
+{
+	audioRing = ring;
+
+	if (soundWorker)
+	{
+		FinishSynthesis();
+		soundWorker->Synthesiser().SetAudioRing(ring);
+	}
+}
+
+void APU::SetCapture(AudioCapture* sink)
+{
+	capture = sink;
+
+	// Starts the stems off in step with the mix
+	ClearBuffer();
+
+	if (soundWorker)
+		soundWorker->Synthesiser().SetCapture(sink);
+}
+
+void APU::SetSampleRate(int rate)
+{
+	blipLeft.SetRates(GemConstants::TClockSpeed, rate, GemConstants::TCyclesPerAPUCycle);
+	blipRight.SetRates(GemConstants::TClockSpeed, rate, GemConstants::TCyclesPerAPUCycle);
+	captureLeft.SetRates(GemConstants::TClockSpeed, rate, GemConstants::TCyclesPerAPUCycle);
+	captureRight.SetRates(GemConstants::TClockSpeed, rate, GemConstants::TCyclesPerAPUCycle);
+	for (BlipBuffer& stem : stemBlips)
+		stem.SetRates(GemConstants::TClockSpeed, rate, GemConstants::TCyclesPerAPUCycle);
+
+	sampleRate = rate;
+	tunedSampleRate = rate;
+
+	// Leave room for the rate adjustment
+	int max_frame_samples = int(int64_t(GemConstants::TCyclesPerAPUCycle) * (rate + rate / 100) / GemConstants::TClockSpeed) + 2;
+	frameSamples.assign(max_frame_samples * 2, 0.0f);
+	captureSamples.assign(max_frame_samples * 2, 0.0f);
+	stemSamples.assign(max_frame_samples * NUM_EMITTERS, 0.0f);
+
+	ClearBuffer();
+
+	if (soundWorker)
+		soundWorker->Synthesiser().SetSampleRate(rate);
+}
+
+void APU::SetRateAdjustment(float ratio)
+{
+	ratio = clamp(ratio, -0.01f, 0.01f);
+	tunedSampleRate = int(lround(sampleRate * (1.0 + ratio)));
+
+	if (soundWorker)
+		soundWorker->SetRateAdjustment(ratio);
+}
+
+void APU::ClearBuffer()
+{
+	blipLeft.Clear();
+	blipRight.Clear();
+	captureLeft.Clear();
+	captureRight.Clear();
+	frameTCycles = 0;
+	mixedLeft = 0;
+	mixedRight = 0;
+	mixDirty = true;
+
+	for (int i = 0; i < NUM_EMITTERS; i++)
+	{
+		stemBlips[i].Clear();
+		stemLevels[i] = 0;
+	}
+
+	if (soundWorker)
+	{
+		FinishSynthesis();
+		soundWorker->Synthesiser().ClearBuffer();
+	}
 }
 
 void APU::TickEmitters(int t_cycles)
 {
-#define MIXLR(index,amplitude) \
-	MixSamples(lmixed, float(amplitude) / 15, float(left_levels[index]) / 7); \
-	MixSamples(rmixed, float(amplitude) / 15, float(right_levels[index]) / 7);
+	if (soundWorker || silent)
+	{
+		TickRegisters(t_cycles);
+		return;
+	}
 
-	static uint8_t left_levels[4];
-	static uint8_t right_levels[4];
+	if (!controller.IsSoundOn())
+		return;
+
+	while (t_cycles > 0)
+	{
+		// Register writes land on the mix at the cycle they were made, so the output doesn't depend on
+		// how the ticks are split up (the square channels gate their level on every Advance)
+		if (mixDirty)
+		{
+			emitter1.Advance(0);
+			emitter2.Advance(0);
+			MixOutput();
+		}
+
+		// Advance every channel up to whichever comes first: the end of the span, the next
+		// frame sequencer step or the next point where a channel's output can change
+		int until_change = min(min(emitter1.CyclesUntilChange(), emitter2.CyclesUntilChange()),
+								min(emitter3.CyclesUntilChange(), emitter4.CyclesUntilChange()));
+		int span = min(t_cycles, min(until_change, GemConstants::TCyclesPerAPUCycle - sequencerTAcc));
+
+		emitter1.Advance(span);
+		emitter2.Advance(span);
+		emitter3.Advance(span);
+		emitter4.Advance(span);
+		t_cycles -= span;
+		frameTCycles += span;
+
+		if (span == until_change)
+			MixOutput();
+
+		sequencerTAcc += span;
+		if (sequencerTAcc == GemConstants::TCyclesPerAPUCycle)
+		{
+			sequencerTAcc = 0;
+			StepFrameSequencer();
+			EndFrame();
+
+			// The square channels pick up envelope changes on their next Advance
+			mixDirty = true;
+		}
+	}
+
+	UpdateChannelStatus();
+}
+
+void APU::TickRegisters(int t_cycles)
+{
+	emulatedCycles += t_cycles;
+
+	if (soundWorker && !silent && emulatedCycles - publishedCycles >= SoundWorker::PublishInterval)
+	{
+		soundWorker->Publish(emulatedCycles);
+		publishedCycles = emulatedCycles;
+	}
 
 	if (!controller.IsSoundOn())
 		return;
 
-	static float lmixed, rmixed, level;
-	uint8_t m = mute ? 0 : 1;
+	// Only the frame sequencer can change what the registers read back, so skip straight to its steps
+	sequencerTAcc += t_cycles;
+	while (sequencerTAcc >= GemConstants::TCyclesPerAPUCycle)
+	{
+		sequencerTAcc -= GemConstants::TCyclesPerAPUCycle;
+		StepFrameSequencer();
+	}
+
+	UpdateChannelStatus();
+}
+
+void APU::UpdateChannelStatus()
+{
+	// Whether a channel is enabled, not whether it's at a high point of its waveform
+	controller.Chan1SetSoundOn(emitter1.IsEnabled());
+	controller.Chan2SetSoundOn(emitter2.IsEnabled());
+	controller.Chan3SetSoundOn(emitter3.IsEnabled());
+	controller.Chan4SetSoundOn(emitter4.IsEnabled());
+}
+
+void APU::MixOutput()
+{
+	uint8_t left_levels[4];
+	uint8_t right_levels[4];
+
+	controller.GetLeftLevelMask(left_levels);
+	controller.GetRightLevelMask(right_levels);
+
+	uint8_t e1 = emitter1.Sample();
+	uint8_t e2 = emitter2.Sample();
+	uint8_t e3 = emitter3.Sample();
+	uint8_t e4 = emitter4.Sample();
+
+	snapshot.L_Emitter1 = e1 * left_levels[0];
+	snapshot.L_Emitter2 = e2 * left_levels[1];
+	snapshot.L_Emitter3 = e3 * left_levels[2];
+	snapshot.L_Emitter4 = e4 * left_levels[3];
+
+	snapshot.R_Emitter1 = e1 * left_levels[0];
+	snapshot.R_Emitter2 = e2 * left_levels[1];
+	snapshot.R_Emitter3 = e3 * left_levels[2];
+	snapshot.R_Emitter4 = e4 * left_levels[3];
+
+	int left = e1 * left_levels[0] * chanMask[0]
+			+ e2 * left_levels[1] * chanMask[1]
+			+ e3 * left_levels[2] * chanMask[2]
+			+ e4 * left_levels[3] * chanMask[3];
+
+	int right = e1 * right_levels[0] * chanMask[0]
+			+ e2 * right_levels[1] * chanMask[1]
+			+ e3 * right_levels[2] * chanMask[2]
+			+ e4 * right_levels[3] * chanMask[3];
+
+	if (left != mixedLeft)
+	{
+		blipLeft.AddDelta(frameTCycles, left - mixedLeft);
+		if (capture)
+			captureLeft.AddDelta(frameTCycles, left - mixedLeft);
+
+		mixedLeft = left;
+	}
+
+	if (right != mixedRight)
+	{
+		blipRight.AddDelta(frameTCycles, right - mixedRight);
+		if (capture)
+			captureRight.AddDelta(frameTCycles, right - mixedRight);
+
+		mixedRight = right;
+	}
 
-	while (t_cycles--)
+	if (capture && capture->HasStems())
 	{
-		emitter1.Tick();
-		emitter2.Tick();
-		emitter3.Tick();
-		emitter4.Tick();
+		uint8_t levels[NUM_EMITTERS] = { e1, e2, e3, e4 };
 
-		if (sampleTAcc == GemConstants::TCyclesPerSample)
+		for (int i = 0; i < NUM_EMITTERS; i++)
 		{
-			controller.GetLeftLevelMask(left_levels);
-			controller.GetRightLevelMask(right_levels);
+			if (levels[i] != stemLevels[i])
+			{
+				stemBlips[i].AddDelta(frameTCycles, levels[i] - stemLevels[i]);
+				stemLevels[i] = levels[i];
+			}
+		}
+	}
 
-			uint8_t e1 = emitter1.Sample();
-			uint8_t e2 = emitter2.Sample();
-			uint8_t e3 = emitter3.Sample();
-			uint8_t e4 = emitter4.Sample();
+	mixDirty = false;
+}
 
-			snapshot.L_Emitter1 = e1 * left_levels[0];
-			snapshot.L_Emitter2 = e2 * left_levels[1];
-			snapshot.L_Emitter3 = e3 * left_levels[2];
-			snapshot.L_Emitter4 = e4 * left_levels[3];
+void APU::EndFrame()
+{
+	bool stems = capture && capture->HasStems();
 
-			snapshot.R_Emitter1 = e1 * left_levels[0];
-			snapshot.R_Emitter2 = e2 * left_levels[1];
-			snapshot.R_Emitter3 = e3 * left_levels[2];
-			snapshot.R_Emitter4 = e4 * left_levels[3];
+	blipLeft.EndFrame(frameTCycles);
+	blipRight.EndFrame(frameTCycles);
 
-			left_levels[0] *= chanMask[0];
-			left_levels[1] *= chanMask[1];
-			left_levels[2] *= chanMask[2];
-			left_levels[3] *= chanMask[3];
+	if (capture)
+	{
+		captureLeft.EndFrame(frameTCycles);
+		captureRight.EndFrame(frameTCycles);
+	}
 
-			right_levels[0] *= chanMask[0];
-			right_levels[1] *= chanMask[1];
-			right_levels[2] *= chanMask[2];
-			right_levels[3] *= chanMask[3];
+	for (int i = 0; stems && i < NUM_EMITTERS; i++)
+		stemBlips[i].EndFrame(frameTCycles);
 
-			lmixed = 0;
-			rmixed = 0;
+	frameTCycles = 0;
 
-			MixSamples(lmixed, float(e1) / 15, float(left_levels[0]) / 7);
-			MixSamples(rmixed, float(e1) / 15, float(right_levels[0]) / 7);
+	// Only what's played is retuned, the capture stays at the nominal rate
+	if (tunedSampleRate != blipLeft.SampleRate())
+	{
+		blipLeft.Retune(tunedSampleRate);
+		blipRight.Retune(tunedSampleRate);
+	}
 
-			MixSamples(lmixed, float(e2) / 15, float(left_levels[1]) / 7);
-			MixSamples(rmixed, float(e2) / 15, float(right_levels[1]) / 7);
+	// A channel at full amplitude (15) and volume (7) contributes 1.0
+	float scale = mute ? 0.0f : 1.0f / (15 * 7);
 
-			MixSamples(lmixed, float(e3) / 15, float(left_levels[2]) / 7);
-			MixSamples(rmixed, float(e3) / 15, float(right_levels[2]) / 7);
+	int count = blipLeft.SamplesAvailable();
+	for (int i = 0; i < count; i++)
+	{
+		frameSamples[i * 2] = blipLeft.ReadSample() * scale;
+		frameSamples[i * 2 + 1] = blipRight.ReadSample() * scale;
+	}
 
-			MixSamples(lmixed, float(e4) / 15, float(left_levels[3]) / 7);
-			MixSamples(rmixed, float(e4) / 15, float(right_levels[3]) / 7);
+	// A full ring is counted as an overrun by the ring itself
+	if (audioRing)
+		audioRing->Write(frameSamples.data(), count);
 
-			buffer.PushBack(lmixed * m);
-			buffer.PushBack(rmixed * m);
-			sampleTAcc = 0;
+	if (capture)
+	{
+		int capture_count = captureLeft.SamplesAvailable();
+		for (int i = 0; i < capture_count; i++)
+		{
+			captureSamples[i * 2] = captureLeft.ReadSample() * scale;
+			captureSamples[i * 2 + 1] = captureRight.ReadSample() * scale;
 		}
-		else
+
+		// A channel at full amplitude contributes 1.0 to its stem
+		for (int i = 0; stems && i < capture_count; i++)
 		{
-			sampleTAcc++;
+			for (int c = 0; c < NUM_EMITTERS; c++)
+				stemSamples[i * NUM_EMITTERS + c] = stemBlips[c].ReadSample() * (1.0f / 15);
 		}
+
+		capture->Write(captureSamples.data(), stemSamples.data(), capture_count);
 	}
+}
 
-	if (audioQueue && buffer.Count() >= AudioQueueSampleCount * 2)
+void APU::StepFrameSequencer()
+{
+	sequencerStep = (sequencerStep + 1) % 8;
+
+	if (sequencerStep % 2 == 0)
 	{
-		// Allow audio queue to catch up slightly
-		int queued_count = audioQueue->GetQueuedSampleCount();
-		if (queued_count > AudioQueueSampleCount * 2)
-		{
-			int ms = int((float(queued_count) * 0.4) / 44.1f);
-			this_thread::sleep_for(chrono::milliseconds(ms));
-			LOG_DIAG("Audio catch up (queued: %d | sleep: %d)", queued_count, ms);
-		}
+		emitter1.TickLength();
+		emitter2.TickLength();
+		emitter3.TickLength();
+		emitter4.TickLength();
+	}
+
+	if (sequencerStep == 1 || sequencerStep == 5)
+	{
+		emitter1.TickSweep();
+		emitter2.TickSweep();
+	}
 
-		audioQueue->PushAudioData(buffer);
-		buffer.Truncate(0);
+	if (sequencerStep == 6)
+	{
+		emitter1.TickEnvelope();
+		emitter2.TickEnvelope();
+		emitter4.TickEnvelope();
 	}
+}
+
+void APU::SetMuted(bool muted)
+{
+	// The debugger sets these every UI frame, so only a real change waits on the sound worker
+	if (mute == muted)
+		return;
 
-	controller.Chan1SetSoundOn(emitter1.IsEmitting());
-	controller.Chan2SetSoundOn(emitter2.IsEmitting());
-	controller.Chan3SetSoundOn(emitter3.IsEmitting());
-	controller.Chan4SetSoundOn(emitter4.IsEmitting());
+	mute = muted;
 
-#undef MIXLR
+	if (soundWorker)
+	{
+		FinishSynthesis();
+		soundWorker->Synthesiser().SetMuted(muted);
+	}
 }
 
 void APU::SetChannelMask(int chan_index, uint8_t mask)
 {
-	if (chan_index >= 0 && chan_index < 4)
-		chanMask[chan_index] = mask;
+	if (chan_index < 0 || chan_index >= 4 || chanMask[chan_index] == mask)
+		return;
+
+	chanMask[chan_index] = mask;
+	mixDirty = true;
+
+	if (soundWorker)
+	{
+		FinishSynthesis();
+		soundWorker->Synthesiser().SetChannelMask(chan_index, mask);
+	}
+}
+
+EmittersSnapshot APU::Snapshot() const
+{
+	return soundWorker ? soundWorker->Snapshot() : snapshot;
 }
 
 void APU::DecodeWaveRAM(uint8_t dest[32])
 {
-	for (int i = 0, j = 0; i < 16; i++, j += 2)
-	{
-		dest[j] = waveRAM[i] >> 4;
-		dest[j + 1] = waveRAM[i] & 0xF;
-	}
+	memcpy(dest, waveSamples, sizeof(uint8_t) * GemConstants::WaveRAMSize);
 }
 
 uint8_t APU::ReadWaveRAM(uint16_t addr)
@@ -174,8 +518,13 @@ uint8_t APU::ReadWaveRAM(uint16_t addr)
 
 void APU::WriteWaveRAM(uint16_t addr, uint8_t value)
 {
+	if (soundWorker && !silent)
+		soundWorker->LogWrite(emulatedCycles, addr, value);
+
 	int index = addr & 0xF;
 	waveRAM[index] = value;
+	waveSamples[index * 2] = value >> 4;
+	waveSamples[index * 2 + 1] = value & 0xF;
 }
 
 uint8_t APU::ReadRegister(uint16_t addr)
@@ -245,6 +594,11 @@ uint8_t APU::ReadRegister(uint16_t addr)
 
 void APU::WriteRegister(uint16_t addr, uint8_t value)
 {
+	if (soundWorker && !silent)
+		soundWorker->LogWrite(emulatedCycles, addr, value);
+
+	mixDirty = true;
+
 	switch (addr)
 	{
 		// Channel 1
@@ -1,7 +1,8 @@
 
 #include <cassert>
 #include <climits>
-#include <cmath>
+#include <bitset>
+#include <algorithm>
 
 #include "Core/GemConstants.h"
 #include "Core/APUEmitters.h"
@@ -16,54 +17,19 @@ SoundEmitter::SoundEmitter(int channel_number)
 	: emit(false)
 	, amplitude(0)
 	, gatedAmplitude(0)
-	, sequencerTAcc(0)
-	, sequencerStep(0)
 	, channelNum(channel_number)
+	, dacOn(false)
+	, soundLenCtr(0)
+	, stopAfterLen(false)
 {
 }
 
-void SoundEmitter::Tick()
+void SoundEmitter::TickLength()
 {
-	TickTClock();
-
-	if (++sequencerTAcc >= TCyclesPerAPUCycle)
-	{
-		sequencerStep = (sequencerStep + 1) % 8;
-		sequencerTAcc -= TCyclesPerAPUCycle;
-
-		if (stopAfterLen && soundLenCtr > 0 && sequencerStep % 2 == 0)
-			Tick256Hz();
-
-		if (sequencerStep == 1 || sequencerStep == 5)
-			Tick128Hz();
-
-		if (sequencerStep == 6)
-			Tick64Hz();
-	}
-}
-
-void SoundEmitter::Tick256Hz()
-{
-	if (--soundLenCtr == 0)
+	if (stopAfterLen && soundLenCtr > 0 && --soundLenCtr == 0)
 		emit = false;
 }
 
-/////////////////////////////
-///    Sinusoid Emitter   ///
-/////////////////////////////
-SinusoidEmitter::SinusoidEmitter()
-	: SoundEmitter(0)
-	, x(0.0f)
-{
-}
-
-void SinusoidEmitter::TickTClock()
-{
-	x += 1;
-	float y = 8 * cos(2 * 3.14159265358979 * (x / 44100) * 100) + 8.01;
-	gatedAmplitude = amplitude = uint16_t(y);
-}
-
 /////////////////////////////
 ///  Square Wave Emitter  ///
 /////////////////////////////
@@ -78,15 +44,36 @@ const uint8_t SquareWaveEmitter::DutyCycleLookUp[4][8] =
 
 SquareWaveEmitter::SquareWaveEmitter(int channel_number)
 	: SoundEmitter(channel_number)
+	, periodData(0)
+	, tCyclesPerWave(0)
+	, freqDivider(0)
+	, waveTCtr(0)
+	, dutyCycleCode(0)
+	, sweepTicksPerShift(0)
+	, sweepCtr(0)
+	, freqDecreasing(false)
+	, waveFormStep(0)
+	, volumeIncreasing(false)
+	, envelopeTicksPerShift(0)
+	, envelopeCtr(0)
 {
 }
 
-void SquareWaveEmitter::TickTClock()
+void SquareWaveEmitter::Advance(int t_cycles)
 {
-	if (--waveTCtr == 0)
+	int until_edge = waveTCtr == 0 ? 0x10000 : waveTCtr;
+
+	if (t_cycles >= until_edge)
 	{
-		waveFormStep = (waveFormStep + 1) % 8;
-		waveTCtr = tCyclesPerWave;
+		int period = uint16_t(tCyclesPerWave) == 0 ? 0x10000 : uint16_t(tCyclesPerWave);
+		int past_edge = t_cycles - until_edge;
+
+		waveFormStep = (waveFormStep + 1 + past_edge / period) % 8;
+		waveTCtr = uint16_t(period - past_edge % period);
+	}
+	else
+	{
+		waveTCtr -= t_cycles;
 	}
 
 	gatedAmplitude = 0;
@@ -96,7 +83,7 @@ void SquareWaveEmitter::TickTClock()
 	}
 }
 
-void SquareWaveEmitter::Tick128Hz()
+void SquareWaveEmitter::TickSweep()
 {
 	if (--sweepCtr == 0)
 	{
@@ -122,7 +109,7 @@ void SquareWaveEmitter::Tick128Hz()
 	}
 }
 
-void SquareWaveEmitter::Tick64Hz()
+void SquareWaveEmitter::TickEnvelope()
 {
 	if (--envelopeCtr == 0)
 	{
@@ -177,30 +164,39 @@ void SquareWaveEmitter::Reset(uint16_t period_data, uint8_t freq_sweep_time, boo
 ///    Wave RAM Player    ///
 /////////////////////////////
 
-ProgrammableWaveEmitter::ProgrammableWaveEmitter(int channel_number, uint8_t wave_ram[])
+ProgrammableWaveEmitter::ProgrammableWaveEmitter(int channel_number, uint8_t wave_samples[])
 	: SoundEmitter(channel_number)
 	, sampleIdx(0)
+	, amplitudeDivider(0)
+	, periodData(0)
+	, waveTCtr(0)
+	, tCyclesPerWave(0)
 {
-	waveRAM = wave_ram;
+	waveSamples = wave_samples;
 }
 
-void ProgrammableWaveEmitter::TickTClock()
+void ProgrammableWaveEmitter::Advance(int t_cycles)
 {
-	if (--waveTCtr == 0)
+	int until_edge = waveTCtr == 0 ? 0x10000 : waveTCtr;
+
+	if (t_cycles < until_edge)
 	{
-		sampleIdx = (sampleIdx + 1) % WaveRAMSize;
-		waveTCtr = tCyclesPerWave;
+		waveTCtr -= t_cycles;
+		return;
+	}
 
-		gatedAmplitude = 0;
-		if (amplitudeDivider > 0 && emit && dacOn)
-		{
-			amplitude = waveRAM[sampleIdx / 2];
-			amplitude = sampleIdx % 2 == 0
-						? amplitude >> 4
-						: amplitude & 0xF;
-			amplitude = amplitude >> (amplitudeDivider - 1);
-			gatedAmplitude = amplitude;
-		}
+	int period = uint16_t(tCyclesPerWave) == 0 ? 0x10000 : uint16_t(tCyclesPerWave);
+	int past_edge = t_cycles - until_edge;
+
+	sampleIdx = (sampleIdx + 1 + past_edge / period) % WaveRAMSize;
+	waveTCtr = uint16_t(period - past_edge % period);
+
+	// Only the sample at the last edge is audible
+	gatedAmplitude = 0;
+	if (amplitudeDivider > 0 && emit && dacOn)
+	{
+		amplitude = waveSamples[sampleIdx] >> (amplitudeDivider - 1);
+		gatedAmplitude = amplitude;
 	}
 }
 
@@ -226,33 +222,159 @@ void ProgrammableWaveEmitter::Reset(uint16_t period_data, uint8_t duration, bool
 ///      Noise Emitter    ///
 /////////////////////////////
 
+// Bit 0 of the LFSR after each shift from 7FFFh, for the full 15 bit width and the 7 bit one
+struct NoiseSequences
+{
+	bitset<NoiseEmitter::LongSequenceLength> Long;
+	bitset<NoiseEmitter::ShortSequenceLength> Short;
+
+	NoiseSequences()
+	{
+		uint16_t lfsr = 0x7FFF;
+		for (int i = 0; i < NoiseEmitter::LongSequenceLength; i++)
+		{
+			Long[i] = lfsr & 0x1;
+			uint16_t xored = (lfsr & 0x1) ^ ((lfsr & 0x2) >> 1);
+			lfsr = (xored << 14) | (lfsr >> 1);
+		}
+
+		lfsr = 0x7F;
+		for (int i = 0; i < NoiseEmitter::ShortSequenceLength; i++)
+		{
+			Short[i] = lfsr & 0x1;
+			uint16_t xored = (lfsr & 0x1) ^ ((lfsr & 0x2) >> 1);
+			lfsr = (xored << 6) | (lfsr >> 1);
+		}
+	}
+};
+
+static const NoiseSequences& Sequences()
+{
+	static const NoiseSequences sequences;
+	return sequences;
+}
+
+// Where 'window' appears as 'width' consecutive bits of the sequence. Every non-zero value does, exactly once,
+// zero is the register stuck at zero (-1).
+template<size_t N>
+static int FindInSequence(const bitset<N>& sequence, uint16_t window, int width)
+{
+	uint16_t bits = 0;
+	for (int i = 0; i < width; i++)
+		bits |= sequence[i] << i;
+
+	for (int i = 0; i < int(N); i++)
+	{
+		if (bits == window)
+			return i;
+
+		bits = (bits >> 1) | (sequence[(i + width) % N] << (width - 1));
+	}
+
+	return -1;
+}
+
 NoiseEmitter::NoiseEmitter(int channel_number)
 	: SoundEmitter(channel_number)
+	, lfsrIdx(0)
+	, entryRegister(0x7FFF)
+	, shiftsSinceEntry(0)
+	, shiftCtr(0)
+	, tCyclesPerShift(0)
+	, shortMode(false)
+	, volumeIncreasing(false)
+	, envelopeTicksPerShift(0)
+	, envelopeCtr(0)
 {
-	soundLenCtr = 0;
 }
 
-void NoiseEmitter::TickTClock()
+void NoiseEmitter::Advance(int t_cycles)
 {
-	if (--shiftCtr == 0)
+	// Left untouched while idle so it can't count down far enough to wrap
+	if (shiftCtr <= 0)
+		return;
+
+	if (t_cycles < shiftCtr)
 	{
-		shiftCtr = tCyclesPerShift;
+		shiftCtr -= t_cycles;
+		return;
+	}
 
-		uint16_t xored = (shiftRegister & 0x1) ^ ((shiftRegister & 0x2) >> 1);
-		shiftRegister >>= 1;
+	// A positive counter means Reset() has loaded a (non-zero) shift period
+	int past_shift = t_cycles - shiftCtr;
+	int shifts = 1 + past_shift / tCyclesPerShift;
+	shiftCtr = tCyclesPerShift - past_shift % tCyclesPerShift;
 
-		shiftRegister = (xored << 14) | (shiftRegister & 0x3FFF);
-		if (shortMode)
-		{
-			shiftRegister = (xored << 6) | (shiftRegister & 0x7FBF);
-		}
+	const NoiseSequences& sequences = Sequences();
+	bool high = false;
 
-		gatedAmplitude = 0;
-		if (emit && dacOn && (shiftRegister & 0x1) == 0)
-		{
-			gatedAmplitude = amplitude;
-		}
+	if (lfsrIdx >= 0 && shortMode)
+	{
+		lfsrIdx = (lfsrIdx + shifts) % ShortSequenceLength;
+		high = sequences.Short[lfsrIdx];
 	}
+	else if (lfsrIdx >= 0)
+	{
+		lfsrIdx = (lfsrIdx + shifts) % LongSequenceLength;
+		high = sequences.Long[lfsrIdx];
+	}
+
+	shiftsSinceEntry = min(shiftsSinceEntry + min(shifts, 8), 8);
+
+	gatedAmplitude = 0;
+	if (emit && dacOn && !high)
+	{
+		gatedAmplitude = amplitude;
+	}
+}
+
+uint16_t NoiseEmitter::ShiftRegister() const
+{
+	// Each bit reaches bit 0 that many shifts later, new bits only ever come in at the top of the width
+	const NoiseSequences& sequences = Sequences();
+	uint16_t reg = 0;
+	bool stuck = lfsrIdx < 0;
+
+	if (!shortMode)
+	{
+		for (int i = 0; i < 15 && !stuck; i++)
+			reg |= sequences.Long[(lfsrIdx + i) % LongSequenceLength] << i;
+
+		return reg;
+	}
+
+	for (int i = 0; i < 7 && !stuck; i++)
+		reg |= sequences.Short[(lfsrIdx + i) % ShortSequenceLength] << i;
+
+	// Bit 14 gets the same bit as bit 6 on every shift, above bit 6 are those trailing the 7 bit sequence
+	// and whatever is left of the register from before the switch
+	for (int i = 7; i < 15; i++)
+	{
+		bool bit = i + shiftsSinceEntry < 15
+					? (entryRegister >> (i + shiftsSinceEntry)) & 0x1
+					: !stuck && sequences.Short[(lfsrIdx + i - 8 + ShortSequenceLength) % ShortSequenceLength];
+
+		reg |= bit << i;
+	}
+
+	return reg;
+}
+
+void NoiseEmitter::SetShortMode(bool short_mode)
+{
+	if (short_mode == shortMode)
+		return;
+
+	// Carry on from the same register in the other sequence
+	uint16_t reg = ShiftRegister();
+	const NoiseSequences& sequences = Sequences();
+
+	shortMode = short_mode;
+	entryRegister = reg;
+	shiftsSinceEntry = 0;
+	lfsrIdx = shortMode
+				? FindInSequence(sequences.Short, reg & 0x7F, 7)
+				: FindInSequence(sequences.Long, reg, 15);
 }
 
 void NoiseEmitter::SetShiftPeriodData(uint8_t base_period_code, uint8_t multiplier)
@@ -263,7 +385,7 @@ void NoiseEmitter::SetShiftPeriodData(uint8_t base_period_code, uint8_t multipli
 	tCyclesPerShift = base_period << multiplier;
 }
 
-void NoiseEmitter::Tick64Hz()
+void NoiseEmitter::TickEnvelope()
 {
 	if (--envelopeCtr == 0)
 	{
@@ -299,6 +421,8 @@ void NoiseEmitter::Reset(uint8_t base_period_code, uint8_t multiplier, bool shor
 	envelopeCtr = envelopeTicksPerShift;
 	dacOn = dac_on;
 
-	shiftRegister = 0x7FFF;
+	lfsrIdx = 0;
+	entryRegister = 0x7FFF;
+	shiftsSinceEntry = 0;
 	emit = true;
 }
\ No newline at end of file
@@ -328,7 +328,7 @@ void Channel4Registers::WritePolynomialRegister(const uint8_t value)
 	periodData = value & 0x07;
 	polynomialRegisterByte = value;
 
-	emitter->shortMode = shortMode;
+	emitter->SetShortMode(shortMode);
 	emitter->SetShiftPeriodData(periodData, shiftClockMultiplier);
 }
 
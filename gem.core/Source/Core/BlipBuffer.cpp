@@ -0,0 +1,102 @@
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+
+#include "Core/BlipBuffer.h"
+
+using namespace std;
+
+BlipBuffer::BlipBuffer()
+	: clockRate(1)
+	, sampleRate(0)
+	, offset(0)
+	, readPos(0)
+	, mask(0)
+	, integrator(0)
+{
+	const double pi = 3.14159265358979323846;
+	const double cutoff = 0.45; // Relative to the output rate, a little under Nyquist
+
+	for (int p = 0; p < KernelPhases; p++)
+	{
+		double taps[KernelWidth];
+		double sum = 0;
+
+		// Each tap is the band-limited impulse at the midpoint between two output samples, i.e. the
+		// difference the step makes between them
+		for (int k = 0; k < KernelWidth; k++)
+		{
+			double x = k + 0.5 - double(p) / KernelPhases - KernelWidth / 2;
+			double sinc = x == 0 ? 1.0 : sin(2 * pi * cutoff * x) / (2 * pi * cutoff * x);
+			double window = 0.42 + 0.5 * cos(2 * pi * x / KernelWidth) + 0.08 * cos(4 * pi * x / KernelWidth);
+			taps[k] = sinc * window;
+			sum += taps[k];
+		}
+
+		// Every phase has to add up to exactly one unit, otherwise the integrated output would drift
+		int total = 0;
+		int largest = 0;
+		for (int k = 0; k < KernelWidth; k++)
+		{
+			kernel[p][k] = int16_t(lround(taps[k] * Unit / sum));
+			total += kernel[p][k];
+
+			if (abs(kernel[p][k]) > abs(kernel[p][largest]))
+				largest = k;
+		}
+
+		kernel[p][largest] += Unit - total;
+	}
+}
+
+void BlipBuffer::SetRates(long clock_rate, int sample_rate, int max_frame_cycles)
+{
+	clockRate = clock_rate;
+	sampleRate = sample_rate;
+
+	// Sized for the highest rate Retune() can reach, rounded up
+	int max_rate = sample_rate + sample_rate / 100 + 1;
+	int max_samples = int(int64_t(max_frame_cycles) * max_rate / clock_rate) + 1 + KernelWidth;
+	uint32_t size = 1;
+	while (size < uint32_t(max_samples))
+		size <<= 1;
+
+	deltas.assign(size, 0);
+	mask = size - 1;
+	Clear();
+}
+
+void BlipBuffer::Clear()
+{
+	fill(deltas.begin(), deltas.end(), 0);
+	offset = 0;
+	readPos = 0;
+	integrator = 0;
+}
+
+void BlipBuffer::AddDelta(int t_cycle, int delta)
+{
+	int64_t pos = offset + int64_t(t_cycle) * sampleRate;
+	uint32_t first = readPos + uint32_t(pos / clockRate);
+	const int16_t* taps = kernel[(pos % clockRate) * KernelPhases / clockRate];
+
+	for (int k = 0; k < KernelWidth; k++)
+		deltas[(first + k) & mask] += delta * taps[k];
+}
+
+void BlipBuffer::EndFrame(int t_cycles)
+{
+	offset += int64_t(t_cycles) * sampleRate;
+}
+
+float BlipBuffer::ReadSample()
+{
+	int32_t& delta = deltas[readPos & mask];
+	integrator += delta;
+	delta = 0;
+
+	readPos++;
+	offset -= clockRate;
+
+	return float(integrator) / Unit;
+}
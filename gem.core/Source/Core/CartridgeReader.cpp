@@ -45,34 +45,11 @@ void CartridgeReader::LoadFile(const char* file)
 	int file_size = fin.tellg();
 	fin.seekg(0, fin.beg);
 
-	if (romData != nullptr)
-	{
-		if (size < file_size)
-		{
-			void* new_ptr = realloc(romData, file_size);
-			if (new_ptr == nullptr)
-				throw exception("Unable to resize rom data allocation");
-
-			romData = static_cast<uint8_t*>(new_ptr);
-		}
-	}
-	else
-	{
-		romData = new uint8_t[file_size];
-	}
-
-	size = file_size;
+	Allocate(file_size);
 	fin.read(reinterpret_cast<char*>(romData), size);
 	fin.close();
 
-	DecodeHeader(romData + 0x100, cartProps);
-
-	if (cartProps.ROMSize > size)
-	{
-		LOG_CONS("ROM size from cartridge header is larger than actual file size");
-		cartProps.ROMSize = size;
-		cartProps.NumROMBanks = size / 0x4000;
-	}
+	DecodeImage();
 
 	string path(file);
 	int pos = path.find_last_of('.');
@@ -92,6 +69,50 @@ void CartridgeReader::LoadFile(const char* file)
 	{
 		LOG_INFO("Gem save file not found: %s");
 	}
+}
+
+void CartridgeReader::LoadImage(const uint8_t* data, unsigned int data_size)
+{
+	Allocate(data_size);
+	memcpy(romData, data, data_size);
+
+	DecodeImage();
+
+	gemSaveExists = false;
+	gemSavePath.clear();
+}
+
+void CartridgeReader::Allocate(unsigned int data_size)
+{
+	if (romData != nullptr)
+	{
+		if (size < data_size)
+		{
+			void* new_ptr = realloc(romData, data_size);
+			if (new_ptr == nullptr)
+				throw exception("Unable to resize rom data allocation");
+
+			romData = static_cast<uint8_t*>(new_ptr);
+		}
+	}
+	else
+	{
+		romData = new uint8_t[data_size];
+	}
+
+	size = data_size;
+}
+
+void CartridgeReader::DecodeImage()
+{
+	DecodeHeader(romData + 0x100, cartProps);
+
+	if (cartProps.ROMSize > size)
+	{
+		LOG_CONS("ROM size from cartridge header is larger than actual file size");
+		cartProps.ROMSize = size;
+		cartProps.NumROMBanks = size / 0x4000;
+	}
 
 	cursor = 0;
 	isLoaded = true;
@@ -0,0 +1,145 @@
+#include <algorithm>
+#include <fstream>
+#include <cstring>
+
+#include "Core/GBSFile.h"
+#include "Logging.h"
+
+using namespace std;
+
+static uint16_t ReadWord(const uint8_t* bytes)
+{
+	return uint16_t(bytes[0] | (bytes[1] << 8));
+}
+
+static string ReadField(const uint8_t* bytes)
+{
+	// 32 bytes, only terminated when it's shorter
+	return string(reinterpret_cast<const char*>(bytes), strnlen(reinterpret_cast<const char*>(bytes), 32));
+}
+
+GBSFile::GBSFile()
+	: header()
+{
+}
+
+void GBSFile::LoadFile(const char* file)
+{
+	ifstream fin(file, ios::binary | ios::in);
+	if (fin.fail())
+		throw exception((string("Unable to open file: ") + string(file)).c_str());
+
+	fin.seekg(0, fin.end);
+	int file_size = fin.tellg();
+	fin.seekg(0, fin.beg);
+
+	if (file_size <= HeaderSize)
+		throw exception("GBS file is too small");
+
+	uint8_t raw[HeaderSize];
+	fin.read(reinterpret_cast<char*>(raw), HeaderSize);
+
+	if (memcmp(raw, "GBS", 3) != 0)
+		throw exception("Not a GBS file");
+
+	header.Version = raw[0x03];
+	header.SongCount = raw[0x04];
+	header.FirstSong = raw[0x05];
+	header.LoadAddress = ReadWord(raw + 0x06);
+	header.InitAddress = ReadWord(raw + 0x08);
+	header.PlayAddress = ReadWord(raw + 0x0A);
+	header.StackPointer = ReadWord(raw + 0x0C);
+	header.TimerModulo = raw[0x0E];
+	header.TimerControl = raw[0x0F];
+	header.Title = ReadField(raw + 0x10);
+	header.Author = ReadField(raw + 0x30);
+	header.Copyright = ReadField(raw + 0x50);
+
+	if (header.Version != 1)
+		LOG_WARN("Unknown GBS version %d, reading it as version 1", header.Version);
+
+	if (header.LoadAddress < MinLoadAddress || header.LoadAddress >= 0x8000)
+		throw exception("GBS load address is outside the range that can be played");
+
+	data.resize(file_size - HeaderSize);
+	fin.read(reinterpret_cast<char*>(data.data()), data.size());
+	fin.close();
+}
+
+shared_ptr<CartridgeReader> GBSFile::BuildImage(int song) const
+{
+	// Smallest ROM size the header can describe (32KB << n) that fits the code at its load address
+	int size_code = 0;
+	while ((0x8000 << size_code) < int(header.LoadAddress + data.size()))
+		size_code++;
+
+	if (size_code > 7)
+		throw exception("GBS file is too large");
+
+	vector<uint8_t> image(0x8000 << size_code, 0xFF);
+	memcpy(image.data() + header.LoadAddress, data.data(), data.size());
+
+	auto jump = [&image](int addr, uint16_t target)
+	{
+		image[addr] = 0xC3;
+		image[addr + 1] = target & 0xFF;
+		image[addr + 2] = target >> 8;
+	};
+
+	// RST n calls the code's own vector at load address + n
+	for (int rst = 0x00; rst <= 0x38; rst += 8)
+		jump(rst, header.LoadAddress + rst);
+
+	// Interrupt vectors: STAT, serial and joypad return straight away
+	for (int addr = 0x40; addr <= 0x60; addr += 8)
+		image[addr] = 0xD9;
+
+	// Entry point and cartridge header
+	image[0x100] = 0x00;
+	jump(0x101, DriverAddress);
+	memset(image.data() + 0x104, 0, DriverAddress - 0x104);
+	memcpy(image.data() + 0x134, header.Title.c_str(), min<size_t>(header.Title.length(), 15));
+	image[0x143] = UsesDoubleSpeed() ? 0x80 : 0x00;
+	image[0x147] = uint8_t(CartridgeType::MBC5_ExRam);
+	image[0x148] = uint8_t(size_code);
+	image[0x149] = 0x02; // 8KB of RAM at A000h, rips often use it as work RAM
+
+	int pc = DriverAddress;
+	auto emit = [&image, &pc](std::initializer_list<uint8_t> bytes)
+	{
+		for (uint8_t byte : bytes)
+			image[pc++] = byte;
+	};
+
+	emit({ 0xF3 }); // di
+	emit({ 0x31, uint8_t(header.StackPointer & 0xFF), uint8_t(header.StackPointer >> 8) }); // ld sp, StackPointer
+
+	if (UsesDoubleSpeed())
+		emit({ 0x3E, 0x01, 0xE0, 0x4D, 0x10, 0x00 }); // ld a, 1; ldh (KEY1), a; stop
+
+	emit({ 0x3E, 0x80, 0xE0, 0x26 }); // ld a, 80h; ldh (NR52), a
+	emit({ 0x3E, 0xFF, 0xE0, 0x25 }); // ld a, FFh; ldh (NR51), a
+	emit({ 0x3E, 0x77, 0xE0, 0x24 }); // ld a, 77h; ldh (NR50), a
+	emit({ 0x3E, header.TimerModulo, 0xE0, 0x06 }); // ld a, TimerModulo; ldh (TMA), a
+	emit({ 0x3E, uint8_t(header.TimerControl & 0x07), 0xE0, 0x07 }); // ld a, TimerControl; ldh (TAC), a
+	emit({ 0x3E, uint8_t(song) }); // ld a, song
+	emit({ 0xCD, uint8_t(header.InitAddress & 0xFF), uint8_t(header.InitAddress >> 8) }); // call InitAddress
+	emit({ 0x3E, uint8_t(UsesTimer() ? 0x04 : 0x01), 0xE0, 0xFF }); // ld a, timer or VBlank; ldh (IE), a
+	emit({ 0xAF, 0xE0, 0x0F }); // xor a; ldh (IF), a
+	emit({ 0xFB }); // ei
+	emit({ 0x76, 0x00, 0x18, 0xFC }); // halt; nop; jr -4
+
+	// The play routine runs from the interrupt with the main loop's registers saved around it
+	uint16_t play_irq = uint16_t(pc);
+	emit({ 0xF5, 0xC5, 0xD5, 0xE5 }); // push af, bc, de, hl
+	emit({ 0xCD, uint8_t(header.PlayAddress & 0xFF), uint8_t(header.PlayAddress >> 8) }); // call PlayAddress
+	emit({ 0xE1, 0xD1, 0xC1, 0xF1 }); // pop hl, de, bc, af
+	emit({ 0xD9 }); // reti
+
+	jump(0x40, play_irq);
+	jump(0x50, play_irq);
+
+	shared_ptr<CartridgeReader> rom = make_shared<CartridgeReader>();
+	rom->LoadImage(image.data(), unsigned(image.size()));
+	return rom;
+}
@@ -1,10 +1,14 @@
 
 #include <cstdio>
+#include <cstring>
 #include <cassert>
+#include <climits>
 
 #include "Logging.h"
 
 #include "Core/GPU.h"
+#include "Core/PixelKernels.h"
+#include "Core/RenderWorker.h"
 
 using namespace std;
 
@@ -14,6 +18,7 @@ GPU::GPU()
 	, bgColourPalette(string("BG Palette"))
 	, sprColourPalette(string("Sprite Palette"))
 	, frameBuffer(LCDWidth, LCDHeight)
+	, pixelAttributes(LCDWidth * LCDHeight, true)
 	, correctionMode(CorrectionMode::Washout)
 	, brightness(1.0f)
 	, bCGB(false)
@@ -22,26 +27,118 @@ GPU::GPU()
 	, dmaSrc(0)
 	, vramBank(0)
 	, vramOffset(0)
+	, spriteLinesHeight(0)
+	, spriteLinesDirty(true)
+	, mapLayersTileDataSelect(-1)
+	, videoVersion(1)
+	, lineMemos{}
+	, frameSkip(0)
+	, framesUntilRender(0)
+	, frameStarted(false)
+	, renderingFrame(true)
+	, accurateMode3(false)
+	, mode3Length(172)
+	, pixelStalls{}
+	, midLineActive(false)
+	, midLineWindow(false)
+	, midLineX(0)
+	, midLineCycle(0)
 {
+	frameBuffer.Fill(GemColour());
+	pixelAttributes.Fill(0);
+	RebuildTileCache();
+	RebuildCorrectedShades();
+	SelectModePath();
 }
 
 void GPU::Reset(bool bCGB)
 {
+	FinishRendering();
+
 	this->bCGB = bCGB;
 
 	vram.Fill(0);
 	oam.Fill(0);
+	RebuildTileCache();
 
 	for (int i = 0; i < NumSprites; i++)
 		sprites[i].Reset(bCGB);
+	SpriteChanged();
 
 	positions.Reset(bCGB);
 	stat.Reset(bCGB);
 
 	bgColourPalette.Reset();
 	sprColourPalette.Reset();
+	RebuildCorrectedShades();
 
 	tAcc = 0;
+
+	frameStarted = false;
+	framesUntilRender = frameSkip;
+
+	mode3Length = 172;
+	midLineActive = false;
+
+	SelectModePath();
+	SyncRenderWorker();
+}
+
+void GPU::ForkFrom(const GPU& parent)
+{
+	shared_ptr<InterruptController> own_interrupts = interrupts;
+	shared_ptr<IMMU> own_mmu = mmu;
+	shared_ptr<RenderWorker> own_worker = renderWorker;
+
+	// The cartridge is read-only so the child shares the parent's, as its MMU does
+	*this = parent;
+
+	interrupts = own_interrupts;
+	mmu = own_mmu;
+	renderWorker = own_worker;
+
+	// A pipelined parent's frame lives with its worker and its memos don't describe it
+	if (parent.renderWorker)
+	{
+		parent.renderWorker->CopyFrame(*this);
+
+		for (LineMemo& memo : lineMemos)
+			memo = LineMemo();
+	}
+
+	SyncRenderWorker();
+}
+
+void GPU::SetPipelined(bool enabled)
+{
+	if (enabled == IsPipelined())
+		return;
+
+	if (enabled)
+	{
+		renderWorker = make_shared<RenderWorker>(*this);
+	}
+	else
+	{
+		FinishRendering();
+		renderWorker = nullptr;
+
+		// Lines were drawn by the worker while these went stale
+		for (LineMemo& memo : lineMemos)
+			memo = LineMemo();
+	}
+}
+
+void GPU::FinishRendering()
+{
+	if (renderWorker)
+		renderWorker->CopyFrame(*this);
+}
+
+void GPU::SyncRenderWorker()
+{
+	if (renderWorker)
+		renderWorker->Sync(*this);
 }
 
 void GPU::SetCartridge(std::shared_ptr<CartridgeReader> ptr)
@@ -88,9 +185,11 @@ void GPU::TickStateMachine(int t_cycles)
 	{
 		case LCDMode::HBlank: // (0)
 		{
-			if (tAcc >= 204)
+			// Modes 2, 3 and 0 always add up to 456 cycles
+			int hblank_length = 376 - mode3Length;
+			if (tAcc >= hblank_length)
 			{
-				tAcc -= 204;
+				tAcc -= hblank_length;
 				IncLineY();
 
 				// Reached the last line
@@ -133,6 +232,7 @@ void GPU::TickStateMachine(int t_cycles)
 					// We entered this state when LineY was 144. This is 11 lines later
 					sout = LCDMode::ReadingOAM;
 					positions.LineY = 0;
+					frameStarted = false;
 
 					if (stat.OAMIntEnabled)
 						interrupts->LCDStatusRequested = true;
@@ -147,6 +247,12 @@ void GPU::TickStateMachine(int t_cycles)
 			{
 				tAcc -= 80;
 				sout = LCDMode::ReadingVRAM;
+
+				if (!frameStarted)
+					BeginFrame();
+
+				midLineActive = false;
+				mode3Length = accurateMode3 ? ComputeMode3Length() : 172;
 			}
 
 			break;
@@ -154,10 +260,27 @@ void GPU::TickStateMachine(int t_cycles)
 
 		case LCDMode::ReadingVRAM: // (3)
 		{
-			if (tAcc >= 172)
+			if (tAcc >= mode3Length)
 			{
-				tAcc -= 172;
-				RenderLine();
+				tAcc -= mode3Length;
+
+				if (midLineActive)
+				{
+					FinishMidLine();
+				}
+				else if (!renderingFrame)
+				{
+					SkipLine();
+				}
+				else if (renderWorker)
+				{
+					renderWorker->SubmitLine(*this);
+					SkipLine();
+				}
+				else
+				{
+					(this->*renderLine)();
+				}
 
 				sout = LCDMode::HBlank;
 
@@ -175,7 +298,7 @@ void GPU::TickStateMachine(int t_cycles)
 					else
 					{
 						for (int i = 0; i < 16; i++)
-							vram[dmaDest++] = mmu->ReadByte(dmaSrc++);
+							WriteVRAM(dmaDest++, mmu->ReadByte(dmaSrc++));
 
 						dma.Length -= 16;
 					}
@@ -221,6 +344,8 @@ void GPU::SetLCDControl(uint8_t value)
 		positions.LineY = 0;
 		positions.WindowLineY = 0;
 		tAcc = 0;
+		mode3Length = 172;
+		midLineActive = false;
 		interrupts->LCDStatusRequested = false;
 	}
 
@@ -235,192 +360,358 @@ void GPU::SetLCDControl(uint8_t value)
 	}
 }
 
-void GPU::RenderLine()
+void GPU::SetFrameSkip(int frames)
 {
-	RenderBGLine();
-	RenderWindowLine();
-	RenderSpriteLine();
+	frameSkip = max(frames, 0);
+
+	// Only ever shorten the countdown, restarting it on every change would hold off drawing indefinitely
+	// while the skip flips back and forth
+	framesUntilRender = min(framesUntilRender, frameSkip);
 }
 
-void GPU::GetTilePixelRow(int line_pos, TilePixelRow& pixels, CGBTileAttribute& tile_attr)
+void GPU::BeginFrame()
 {
-	// This function takes a position in [0,255] and combined with LineY+SCY 
-	// computes the colours numbers for the 8 pixel row that needs to be rendedered
-	// In CGB mode it also fetches the tile attributes
+	frameStarted = true;
 
-	const int abs_ln = (positions.LineY + positions.ScrollY) % TileMapWidth;
-	const int map_row_start = (abs_ln / 8) * 32;
-	int abs_col = line_pos + positions.ScrollX;
-	int map_index = control.GetBGTileMapVRAMIndex() + map_row_start + (abs_col / 8) % 32; // Addr of 1byte tile num
+	if (framesUntilRender > 0)
+	{
+		framesUntilRender--;
+		renderingFrame = false;
+	}
+	else
+	{
+		framesUntilRender = frameSkip;
+		renderingFrame = true;
+	}
+}
 
-	uint8_t tile_num;
+void GPU::SkipLine()
+{
+	if (IsWindowOnLine(bCGB))
+		positions.WindowLineY++;
+}
 
-	if (control.BGWindowTileDataSelect == 0)
-		tile_num = int8_t(vram[map_index]) + 128;
-	else
-		tile_num = vram[map_index];
+bool GPU::IsWindowOnLine(bool cgb) const
+{
+	// On DMG the window is hidden along with the BG
+	return control.WindowEnabled
+		&& (cgb || control.BGDisplay)
+		&& positions.WindowX <= 166
+		&& positions.WindowY <= positions.LineY;
+}
 
-	if (bCGB)
-		tile_attr.DecodeFromByte(vram[0x2000 + map_index]);
+int GPU::ComputeMode3Length()
+{
+	// Penalties as listed in pan docs: the discarded SCX pixels, 6 cycles to start fetching the window
+	// and 6-11 cycles per sprite depending on where it sits against the BG tiles.
+	memset(pixelStalls, 0, sizeof(pixelStalls));
+	pixelStalls[0] = positions.ScrollX % 8;
 
-	int pixel_row;
-	if (bCGB && tile_attr.VerticalFlip)
-		pixel_row = 7 - (abs_ln % 8);
-	else
-		pixel_row = abs_ln % 8;
+	if (IsWindowOnLine(bCGB))
+		pixelStalls[min(max(positions.WindowX - 7, 0), LCDWidth)] += 6;
+
+	if (control.SpriteEnabled && positions.LineY < LCDHeight)
+	{
+		int sprite_height = control.SpriteSize == 0 ? 8 : 16;
+		if (spriteLinesDirty || spriteLinesHeight != sprite_height)
+			BuildSpriteLines(sprite_height);
+
+		const SpriteLine& sprite_line = spriteLines[positions.LineY];
+		for (int i = 0; i < sprite_line.Count; i++)
+		{
+			const SpriteData& sprite = sprites[sprite_line.Sprites[i]];
+			pixelStalls[min(max<int>(sprite.XPos, 0), LCDWidth)] += 11 - min(5, (sprite.XPos + positions.ScrollX) & 7);
+		}
+	}
 
-	int tile_data_index = control.GetTileDataVRAMIndex() + (tile_num * 16) + (pixel_row * 2);
+	int length = 172;
+	for (int i = 0; i <= LCDWidth; i++)
+		length += pixelStalls[i];
 
-	bool bank_1 = bCGB && tile_attr.VRAMBank == 1;
-	bool horizontal_flip = bCGB && tile_attr.HorizontalFlip;
-	ReadPixels(pixels, tile_data_index, bank_1, horizontal_flip);
+	return length;
 }
 
-void GPU::RenderBGLine()
+void GPU::CatchUpLine()
 {
-	static TilePixelRow pixels;
-	static CGBTileAttribute tile_attr;
+	// Called just before a write that changes how pixels look. The pixels pushed up to now are drawn
+	// with the values from before it, the rest of the line is drawn later on.
+	if (stat.Mode != LCDMode::ReadingVRAM || !accurateMode3 || !renderingFrame || renderWorker)
+		return;
 
-	// Skip if BG is disabled
-	if (!control.BGDisplay && !bCGB)
+	if (!midLineActive)
+	{
+		midLineActive = true;
+		midLineWindow = false;
+		midLineX = 0;
+		midLineCycle = 12 + pixelStalls[0];
+
+		// What the line looks like can't be told from the registers at the end of it
+		lineMemos[positions.LineY] = LineMemo();
+	}
+
+	(this->*renderPixelsUntil)(tAcc);
+}
+
+void GPU::FinishMidLine()
+{
+	(this->*renderPixelsUntil)(INT_MAX);
+
+	if (midLineWindow)
+		positions.WindowLineY++;
+
+	midLineActive = false;
+}
+
+template<bool CGB>
+void GPU::RenderPixelsUntil(int cycle)
+{
+	int end = midLineX;
+	int end_cycle = midLineCycle;
+
+	while (end < LCDWidth && end_cycle <= cycle)
+	{
+		end++;
+		end_cycle += 1 + pixelStalls[end];
+	}
+
+	if (end == midLineX)
 		return;
 
-	for (uint8_t i = 0; i < LCDWidth;)
+	if (numDirtyMapEntries > 0 || anyTileChanged || control.BGWindowTileDataSelect != mapLayersTileDataSelect)
+		RefreshMapLayers();
+
+	ResolveLineShades<CGB>();
+	RenderBGLine<CGB>(midLineX, end);
+	midLineWindow |= RenderWindowLine<CGB>(midLineX, end);
+	RenderSpriteLine<CGB>(midLineX, end);
+
+	midLineX = end;
+	midLineCycle = end_cycle;
+}
+
+void GPU::SelectModePath()
+{
+	// Resolve the DMG/CGB specialisations once so that the per-line renderers don't
+	// have to keep testing bCGB for every tile and pixel.
+	renderLine = bCGB ? &GPU::RenderLine<true> : &GPU::RenderLine<false>;
+	renderPixelsUntil = bCGB ? &GPU::RenderPixelsUntil<true> : &GPU::RenderPixelsUntil<false>;
+}
+
+template<bool CGB>
+void GPU::RenderLine()
+{
+	LineKey key = GetLineKey();
+	LineMemo& memo = lineMemos[positions.LineY];
+
+	if (memo.Key == key)
 	{
-		GetTilePixelRow(i, pixels, tile_attr);
+		positions.WindowLineY += memo.WindowLinesAdvanced;
+		return;
+	}
 
-		int buff_index = positions.LineY * frameBuffer.Width + i;
-		assert(buff_index < frameBuffer.Count());
+	if (numDirtyMapEntries > 0 || anyTileChanged || control.BGWindowTileDataSelect != mapLayersTileDataSelect)
+		RefreshMapLayers();
 
-		int skip = (i + positions.ScrollX) % 8;
+	ResolveLineShades<CGB>();
+	RenderBGLine<CGB>(0, LCDWidth);
+	if (RenderWindowLine<CGB>(0, LCDWidth))
+		positions.WindowLineY++;
+	RenderSpriteLine<CGB>(0, LCDWidth);
 
-		if (bCGB)
-		{
-			uint8_t palette_index = tile_attr.Palette;
+	memo.Key = key;
+	memo.WindowLinesAdvanced = positions.WindowLineY - key.WindowLineY;
+}
 
-			for (int p = skip, j = 0;
-					p < 8 && i < LCDWidth; 
-					p++, j++)
-			{
-				GemColour& px = frameBuffer[buff_index + j];
-				px = bgColourPalette.GetColour(palette_index, pixels[p]);
-				px.Correct(correctionMode, brightness);
-				px.ColourNumber = pixels[p];
-				px.Priority = tile_attr.PriorityOverSprites;
-				i++;
-			}
-		}
-		else
+GPU::LineKey GPU::GetLineKey() const
+{
+	LineKey key;
+	key.Version = videoVersion;
+	key.Control = control.RegisterByte;
+	key.ScrollX = positions.ScrollX;
+	key.ScrollY = positions.ScrollY;
+	key.WindowX = positions.WindowX;
+	key.WindowY = positions.WindowY;
+	key.WindowLineY = positions.WindowLineY;
+	key.MonoPalettes[0] = bgMonoPalette.BgPaletteRegisterByte;
+	key.MonoPalettes[1] = sprMonoPalettes[0].BgPaletteRegisterByte;
+	key.MonoPalettes[2] = sprMonoPalettes[1].BgPaletteRegisterByte;
+	return key;
+}
+
+bool GPU::LineKey::operator==(const LineKey& other) const
+{
+	return Version == other.Version
+		&& Control == other.Control
+		&& ScrollX == other.ScrollX
+		&& ScrollY == other.ScrollY
+		&& WindowX == other.WindowX
+		&& WindowY == other.WindowY
+		&& WindowLineY == other.WindowLineY
+		&& MonoPalettes[0] == other.MonoPalettes[0]
+		&& MonoPalettes[1] == other.MonoPalettes[1]
+		&& MonoPalettes[2] == other.MonoPalettes[2];
+}
+
+template<bool CGB>
+void GPU::ResolveLineShades()
+{
+	if constexpr (CGB)
+	{
+		lineShades = correctedShades;
+	}
+	else
+	{
+		const PixelFormat format = frameBuffer.Format;
+
+		for (int i = 0; i < 4; i++)
 		{
-			for (int p = skip, j = 0; 
-					p < 8 && i < LCDWidth; 
-					p++, j++)
-			{
-				frameBuffer[buff_index + j] = bgMonoPalette.GetColour(pixels[p]);
-				frameBuffer[buff_index + j].ColourNumber = pixels[p];
-				i++;
-			}
+			lineShades.BG[i] = bgMonoPalette.GetColour(i, dmgPalette).Pack(format);
+			lineShades.Sprite[i] = sprMonoPalettes[0].GetColour(i, dmgPalette).Pack(format);
+			lineShades.Sprite[4 + i] = sprMonoPalettes[1].GetColour(i, dmgPalette).Pack(format);
 		}
 	}
 }
 
-void GPU::GetWindowTilePixelRow(int line_pos, TilePixelRow& pixels, CGBTileAttribute& tile_attr)
+void GPU::UpdateCorrectedShade(ColourPalette& palette, int entry_index)
 {
-	// This function takes a position in [0,255] and combined with LineY+SCY 
-	// computes the colour numbers for the 8px-wide row that needs to be rendered.
-	// In CGB mode it also fetches the tile attributes
+	GemColour colour = palette.Data[entry_index].Colour;
+	colour.Correct(correctionMode, brightness);
 
-	const int abs_ln = positions.WindowLineY;
-	const int map_row_start = (positions.WindowLineY / 8) * 32;
+	uint32_t* shades = &palette == &bgColourPalette ? correctedShades.BG : correctedShades.Sprite;
+	uint32_t shade = colour.Pack(frameBuffer.Format);
 
-	int map_index = control.GetWindowTileMapVRAMIndex() + map_row_start + (line_pos / 8); // Addr of 1byte tile num
+	if (shades[entry_index] != shade)
+	{
+		shades[entry_index] = shade;
+		videoVersion++;
+	}
+}
 
-	uint8_t tile_num;
+void GPU::RebuildCorrectedShades()
+{
+	for (int i = 0; i < 32; i++)
+	{
+		UpdateCorrectedShade(bgColourPalette, i);
+		UpdateCorrectedShade(sprColourPalette, i);
+	}
+}
 
-	if (control.BGWindowTileDataSelect == 0)
-		tile_num = int8_t(vram[map_index]) + 128;
-	else
-		tile_num = vram[map_index];
+void GPU::SetColourCorrectionMode(CorrectionMode mode)
+{
+	FinishRendering();
+	correctionMode = mode;
+	RebuildCorrectedShades();
+	SyncRenderWorker();
+}
 
-	if (bCGB)
-		tile_attr.DecodeFromByte(vram[0x2000 + map_index]);
+void GPU::SetBrightness(float value)
+{
+	FinishRendering();
+	brightness = value;
+	RebuildCorrectedShades();
+	SyncRenderWorker();
+}
 
-	int pixel_row;
-	if (bCGB && tile_attr.VerticalFlip)
-		pixel_row = 7 - (abs_ln % 8);
-	else
-		pixel_row = abs_ln % 8;
+void GPU::SetPixelFormat(PixelFormat format)
+{
+	FinishRendering();
+	frameBuffer.Convert(format);
+	RebuildCorrectedShades();
+	SyncRenderWorker();
+}
 
-	int tile_data_index = control.GetTileDataVRAMIndex() + (tile_num * 16) + (pixel_row * 2);
+void GPU::SetDMGPalette(const GemPalette& palette)
+{
+	FinishRendering();
+	dmgPalette = palette;
 
-	bool bank_1 = bCGB && tile_attr.VRAMBank == 1;
-	bool horizontal_flip = bCGB && tile_attr.HorizontalFlip;
-	ReadPixels(pixels, tile_data_index, bank_1, horizontal_flip);
+	// DMG line shades are resolved from this palette as each line renders, so only the memos need invalidating
+	videoVersion++;
+	SyncRenderWorker();
 }
 
-void GPU::RenderWindowLine()
+// Number of pixels from 'col' up to 'max_count' whose map entries share the palette and priority of col's
+static inline int SharedAttrRun(const uint8_t* entry_attrs, int col, int max_count)
 {
-	static CGBTileAttribute tile_attr;
-	static TilePixelRow pixels;
+	int end = col + max_count;
+	int run_end = (col / 8 + 1) * 8;
 
-	// Skip if window is disabled
-	if (!control.WindowEnabled || (!bCGB && !control.BGDisplay))
-		return;
+	while (run_end < end && entry_attrs[run_end / 8] == entry_attrs[col / 8])
+		run_end += 8;
 
-	if (positions.WindowX > 166 || positions.WindowY > positions.LineY)
-		return;
+	return min(run_end, end) - col;
+}
 
-	int xpos = 7 - positions.WindowX;
-	for (int i = 0; i < LCDWidth;)
+template<bool CGB>
+void GPU::RenderBGLine(int start, int end)
+{
+	// Skip if BG is disabled
+	if constexpr (!CGB)
 	{
-		if (i < positions.WindowX - 7)
-		{
-			i++;
-			xpos++;
-			continue;
-		}
+		if (!control.BGDisplay)
+			return;
+	}
 
-		GetWindowTilePixelRow(xpos, pixels, tile_attr);
+	int line_index = positions.LineY * frameBuffer.Width;
+	uint32_t* line = frameBuffer.Ptr() + line_index;
+	uint8_t* line_attrs = pixelAttributes.Ptr() + line_index;
 
-		int buff_index = positions.LineY * frameBuffer.Width + i;
-		assert(buff_index < frameBuffer.Count());
-		
-		int skip = xpos % 8;
+	// The line is a wrapped copy out of the selected map's layer at (SCX, SCY + LY)
+	const int layer = (control.GetBGTileMapVRAMIndex() - 0x1800) / NumMapEntries;
+	const int abs_ln = (positions.LineY + positions.ScrollY) % TileMapHeight;
+	const uint8_t* layer_row = mapLayers + layer * MapLayerSize + abs_ln * TileMapWidth;
+	const uint8_t* entry_attrs = mapLayerAttrs + layer * NumMapEntries + (abs_ln / 8) * 32;
 
-		if (bCGB)
-		{
-			uint8_t palette_index = tile_attr.Palette;
+	const PixelKernels::CompositeFunc composite = PixelKernels::Get().Composite;
 
-			for (int p = skip, j = 0;
-					p < 8 && i < LCDWidth;
-					p++, j++)
-			{
-				GemColour& px = frameBuffer[buff_index + j];
-				px = bgColourPalette.GetColour(palette_index, pixels[p]);
-				px.Correct(correctionMode, brightness);
-				px.ColourNumber = pixels[p];
-				i++;
-				xpos++;
-			}
-		}
-		else
-		{
-			for (int p = skip, j = 0;
-					p < 8 && i < LCDWidth;
-					p++, j++)
-			{
-				frameBuffer[buff_index + j] = bgMonoPalette.GetColour(pixels[p]);
-				frameBuffer[buff_index + j].ColourNumber = pixels[p];
-				i++;
-				xpos++;
-			}
-		}
+	// Runs go as far as the map entries share a palette and priority (always, on DMG) and the map doesn't wrap
+	for (int i = start; i < end;)
+	{
+		int abs_col = (i + positions.ScrollX) % TileMapWidth;
+		int count = SharedAttrRun(entry_attrs, abs_col, min(end - i, TileMapWidth - abs_col));
+
+		uint8_t entry_attr = entry_attrs[abs_col / 8];
+		const uint32_t* shades = lineShades.BG + (entry_attr & MapAttrPalette) * 4;
+
+		composite(line + i, line_attrs + i, layer_row + abs_col, count, shades, entry_attr & AttrPriority);
+		i += count;
 	}
+}
+
+template<bool CGB>
+bool GPU::RenderWindowLine(int start, int end)
+{
+	if (!IsWindowOnLine(CGB))
+		return false;
+
+	int line_index = positions.LineY * frameBuffer.Width;
+	uint32_t* line = frameBuffer.Ptr() + line_index;
+	uint8_t* line_attrs = pixelAttributes.Ptr() + line_index;
+
+	const int layer = (control.GetWindowTileMapVRAMIndex() - 0x1800) / NumMapEntries;
+	const uint8_t* layer_row = mapLayers + layer * MapLayerSize + positions.WindowLineY * TileMapWidth;
+	const uint8_t* entry_attrs = mapLayerAttrs + layer * NumMapEntries + (positions.WindowLineY / 8) * 32;
+
+	const PixelKernels::CompositeFunc composite = PixelKernels::Get().Composite;
+
+	int i = max(positions.WindowX - 7, start);
+	int xpos = i - (positions.WindowX - 7);
+	while (i < end)
+	{
+		int count = SharedAttrRun(entry_attrs, xpos, end - i);
 
-	positions.WindowLineY++;
+		const uint32_t* shades = lineShades.BG + (entry_attrs[xpos / 8] & MapAttrPalette) * 4;
+
+		composite(line + i, line_attrs + i, layer_row + xpos, count, shades, 0);
+		i += count;
+		xpos += count;
+	}
+
+	return true;
 }
 
-void GPU::RenderSpriteLine()
+template<bool CGB>
+void GPU::RenderSpriteLine(int start, int end)
 {
 	// Skip if sprites are disabled
 	if (!control.SpriteEnabled)
@@ -429,167 +720,299 @@ void GPU::RenderSpriteLine()
 	int sprite_height = control.SpriteSize == 0 
 						? 8 : 16;
 
-	static TilePixelRow pixels;
-	int sprites_rendered = 0;
+	if (spriteLinesDirty || spriteLinesHeight != sprite_height)
+		BuildSpriteLines(sprite_height);
 
-	for (int i = 0; i < NumSprites; i++)
-	{
-		// Lower number sprites have higher priority (they're drawn overtop of lower numbers)
-		// We can account for this by rendering the high priority ones last.
-		int sprite_num = NumSprites - i - 1;
+	const SpriteLine& sprite_line = spriteLines[positions.LineY];
+	const PixelKernels::MergeSpriteFunc merge_sprite = PixelKernels::Get().MergeSprite;
+
+	int line_index = positions.LineY * frameBuffer.Width;
+	uint32_t* line = frameBuffer.Ptr() + line_index;
+	uint8_t* line_attrs = pixelAttributes.Ptr() + line_index;
 
+	for (int i = 0; i < sprite_line.Count; i++)
+	{
 		// Since we've been actively decoding sprite attributes on each write to the OAM,
 		// we don't have to worry about doing it in this hot loop and function.
-		// TODO: the same can be done with tiles where on each vram write, the corresponding tile is deserialized this loop simply copies the line of pixels that it needs
-		SpriteData& sprite = sprites[sprite_num];
+		SpriteData& sprite = sprites[sprite_line.Sprites[i]];
 
-		// Only render if LY occurs between the top and bottom of this sprite
-		if (positions.LineY >= sprite.YPos && positions.LineY < (sprite.YPos + sprite_height)
-			&& sprite.XPos >= -7 && sprite.XPos <= LCDWidth)
-		{
-			// Only 10 sprites can be drawn per line
-			if (++sprites_rendered > 10)
-				return;
+		int abs_ln = positions.LineY - sprite.YPos;
 
-			int abs_ln = positions.LineY - sprite.YPos;
-
-			int pixel_row = 0;
-			if (sprite.VerticalFlip)
-				pixel_row = (sprite_height - 1) - (abs_ln % sprite_height);
-			else
-				pixel_row = abs_ln % sprite_height;
-
-			// For sprites that are 16px tall, any pixels in the lower half of the sprite
-			// will be located 16 bytes after the top half's tile. In other words, the top and 
-			// bottom are stored as back-to-back tiles
-			int tile = sprite.Tile;
-			if (sprite_height == 16)
-			{
-				if (pixel_row >= 8)
-				{
-					tile |= 0x01;
-					pixel_row -= 8;
-				}
-				else
-				{
-					tile &= 0xFE;
-				}
-			}
-
-			// It seems sprite tile data is always at located in 8000h-8FFFh, the offset into VRAM is 0
-			int data_index = (tile * 16) + (pixel_row * 2);
+		int pixel_row = 0;
+		if (sprite.VerticalFlip)
+			pixel_row = (sprite_height - 1) - (abs_ln % sprite_height);
+		else
+			pixel_row = abs_ln % sprite_height;
 
-			uint8_t b0;
-			uint8_t b1;
-			if (bCGB && sprite.VRAMBank == 1)
+		// For sprites that are 16px tall, any pixels in the lower half of the sprite
+		// will be located 16 bytes after the top half's tile. In other words, the top and 
+		// bottom are stored as back-to-back tiles
+		int tile = sprite.Tile;
+		if (sprite_height == 16)
+		{
+			if (pixel_row >= 8)
 			{
-				b0 = vram[0x2000 + data_index];
-				b1 = vram[0x2000 + data_index + 1];
+				tile |= 0x01;
+				pixel_row -= 8;
 			}
 			else
 			{
-				b0 = vram[data_index];
-				b1 = vram[data_index + 1];
+				tile &= 0xFE;
 			}
+		}
 
-			// Early out for colour number 0 which is always transparent
-			if (b0 == 0 && b1 == 0)
-				continue;
+		// It seems sprite tile data is always at located in 8000h-8FFFh, the offset into VRAM is 0
+		int data_index = (tile * 16) + (pixel_row * 2);
+		const uint8_t* pixels = GetTileRow(data_index, CGB && sprite.VRAMBank == 1, sprite.HorizontalFlip);
 
-			DecodePixels(pixels, b0, b1, sprite.HorizontalFlip);
+		// Early out for colour number 0 which is always transparent
+		if (IsBlankRow(pixels))
+			continue;
 
-			int buff_index = positions.LineY * frameBuffer.Width + sprite.XPos;
+		// Clip the row to [start, end)
+		int first = max(start - sprite.XPos, 0);
+		int last = min(end - sprite.XPos, 8);
+		if (first >= last)
+			continue;
 
-			if (bCGB)
-			{
-				for (int i = 0; i < 8; i++)
-				{
-					if (buff_index + i >= frameBuffer.Count())
-						break;
+		const uint32_t* shades = lineShades.Sprite + (CGB ? sprite.CGBPalette : sprite.DMGPalette) * 4;
+		bool force = CGB && control.BGDisplay;
 
-					int xpos = sprite.XPos + i;
-					if (xpos >= 0 && xpos <= LCDWidth)
-					{
-						GemColour& px = frameBuffer[buff_index + i];
+		int xpos = sprite.XPos + first;
+		merge_sprite(line + xpos, line_attrs + xpos, pixels + first, last - first, shades, sprite.BehindBG, force);
+	}
+}
 
-						bool replaced = px.ReplaceWithSpritePixel(sprColourPalette.GetColour(sprite.CGBPalette, pixels[i]),
-																	pixels[i], 
-																	sprite.BehindBG, 
-																	bCGB && control.BGDisplay);
+void GPU::BuildSpriteLines(int sprite_height)
+{
+	for (SpriteLine& line : spriteLines)
+		line.Count = 0;
 
-						if (replaced && pixels[i] != 0) // Don't scale colour 0
-						{
-							px.Correct(correctionMode, brightness);
-						}
-					}
-				}
-			}
-			else
-			{
-				for (int i = 0; i < 8; i++)
-				{
-					if (buff_index + i > frameBuffer.Count())
-						break;
+	// Lower number sprites have higher priority (they're drawn overtop of lower numbers)
+	// We can account for this by listing the high priority ones last.
+	for (int sprite_num = NumSprites - 1; sprite_num >= 0; sprite_num--)
+	{
+		const SpriteData& sprite = sprites[sprite_num];
 
-					int xpos = sprite.XPos + i;
-					if (xpos >= 0 && xpos <= LCDWidth)
-					{
-						frameBuffer[buff_index + i].ReplaceWithSpritePixel(sprMonoPalettes[sprite.DMGPalette].GetColour(pixels[i]), pixels[i], sprite.BehindBG, false);
-					}
-				}
-			}
+		if (sprite.XPos < -7 || sprite.XPos > LCDWidth)
+			continue;
+
+		int first_line = max<int>(sprite.YPos, 0);
+		int end_line = min<int>(sprite.YPos + sprite_height, LCDHeight);
+
+		for (int ln = first_line; ln < end_line; ln++)
+		{
+			// Only 10 sprites can be drawn per line
+			SpriteLine& line = spriteLines[ln];
+			if (line.Count < MaxSpritesPerLine)
+				line.Sprites[line.Count++] = uint8_t(sprite_num);
 		}
 	}
+
+	spriteLinesHeight = sprite_height;
+	spriteLinesDirty = false;
 }
 
-inline void GPU::ReadPixels(TilePixelRow& pixels, int vram_index, bool read_bank_1, bool horizontal_flip)
+void GPU::ClearFrameBuffer()
 {
-	uint8_t b0;
-	uint8_t b1;
-	if (bCGB && read_bank_1)
+	frameBuffer.Zero();
+	pixelAttributes.Fill(0);
+	videoVersion++;
+	SyncRenderWorker();
+}
+
+void GPU::WriteVRAM(int index, uint8_t value)
+{
+	if (vram[index] == value)
+		return;
+
+	vram.Write(index, value);
+	videoVersion++;
+
+	if (renderWorker)
+		renderWorker->LogWrite(RenderWorker::WriteTarget::VRAM, index, value);
+
+	// 8000h-97FFh in either bank is tile data, the rest is tile maps/attributes
+	if ((index & 0x1FFF) < NumTilesPerBank * 16)
+		UpdateTileCacheRow(index & ~1);
+	else
+		MarkMapEntryDirty(index & 0x7FF);
+}
+
+// Moves bit n of b into the lowest bit of byte n
+static inline uint64_t SpreadBits(uint8_t b)
+{
+	// Replicate b into every byte, keep bit n in byte n, then push that bit up to bit 7 of its byte
+	// by adding 0x7F (no byte can carry into the next) and shift it back down to bit 0.
+	uint64_t x = (b * 0x0101010101010101ULL) & 0x8040201008040201ULL;
+	return ((x + 0x7F7F7F7F7F7F7F7FULL) >> 7) & 0x0101010101010101ULL;
+}
+
+static inline uint64_t ReverseBytes(uint64_t x)
+{
+	x = (x & 0x00000000FFFFFFFFULL) << 32 | (x >> 32);
+	x = (x & 0x0000FFFF0000FFFFULL) << 16 | (x >> 16 & 0x0000FFFF0000FFFFULL);
+	x = (x & 0x00FF00FF00FF00FFULL) << 8 | (x >> 8 & 0x00FF00FF00FF00FFULL);
+	return x;
+}
+
+void GPU::UpdateTileCacheRow(int vram_index)
+{
+	// b0 and b1 have the 8 pixels of a tile row
+	// b1 has the higher of the two bits for a pixel and b0 has the lower bit.
+	uint8_t b0 = vram[vram_index];
+	uint8_t b1 = vram[vram_index + 1];
+
+	// All 8 colour numbers are decoded at once. The leftmost pixel is bit 7 so the spread
+	// (bit 0 first) is already the flipped row; the normal row is the same bytes reversed.
+	uint64_t flipped_pixels = SpreadBits(b0) | SpreadBits(b1) << 1;
+	uint64_t pixels = ReverseBytes(flipped_pixels);
+
+	int bank = vram_index >> 13;
+	int tile = (vram_index & 0x1FFF) >> 4;
+	int row = (vram_index & 0xF) >> 1;
+	int cache_index = (bank * NumTilesPerBank + tile) * 64 + row * 8;
+
+	// The cache is stored in memory order, which assumes a little-endian host like the rest of the core
+	memcpy(tileCache + cache_index, &pixels, sizeof(pixels));
+	memcpy(tileCacheFlipped + cache_index, &flipped_pixels, sizeof(flipped_pixels));
+
+	tileChanged[bank * NumTilesPerBank + tile] = true;
+	anyTileChanged = true;
+}
+
+void GPU::RebuildTileCache()
+{
+	for (int bank = 0; bank < 2; bank++)
 	{
-		b0 = vram[0x2000 + vram_index];
-		b1 = vram[0x2000 + vram_index + 1];
+		for (int i = 0; i < NumTilesPerBank * 16; i += 2)
+			UpdateTileCacheRow(bank * 0x2000 + i);
 	}
+
+	memset(tileChanged, 0, sizeof(tileChanged));
+	anyTileChanged = false;
+	MarkAllMapEntriesDirty();
+	videoVersion++;
+}
+
+// Entries are numbered across both maps (9800h-9FFFh) and index the map layers directly
+int GPU::GetMapEntryTile(int entry, CGBTileAttribute& tile_attr)
+{
+	int map_index = 0x1800 + entry;
+
+	uint8_t tile_num;
+
+	if (control.BGWindowTileDataSelect == 0)
+		tile_num = int8_t(vram[map_index]) + 128;
 	else
+		tile_num = vram[map_index];
+
+	tile_attr.DecodeFromByte(bCGB ? vram[0x2000 + map_index] : 0);
+
+	int tile_data_index = control.GetTileDataVRAMIndex() + (tile_num * 16);
+	return tile_attr.VRAMBank * NumTilesPerBank + tile_data_index / 16;
+}
+
+void GPU::MarkMapEntryDirty(int entry)
+{
+	if (!mapEntryDirty[entry])
 	{
-		b0 = vram[vram_index];
-		b1 = vram[vram_index + 1];
+		mapEntryDirty[entry] = true;
+		dirtyMapEntries[numDirtyMapEntries++] = uint16_t(entry);
 	}
+}
 
-	DecodePixels(pixels, b0, b1, horizontal_flip);
+void GPU::MarkAllMapEntriesDirty()
+{
+	for (int entry = 0; entry < NumMapEntries * 2; entry++)
+	{
+		mapEntryDirty[entry] = true;
+		dirtyMapEntries[entry] = uint16_t(entry);
+	}
+
+	numDirtyMapEntries = NumMapEntries * 2;
 }
 
-inline void GPU::DecodePixels(TilePixelRow& pixels, uint8_t b0, uint8_t b1, bool horizontal_flip) 
+void GPU::RefreshMapLayers()
 {
-	// b0 and b1 have the 8 pixels that we need to render
-	// b1 has the higher of the two bits for a pixel and b0 has the lower bit.
-	if (horizontal_flip)
+	// Switching tile data areas changes which tile every entry refers to
+	if (control.BGWindowTileDataSelect != mapLayersTileDataSelect)
 	{
-		pixels.p7 = (b1 & 0x80) >> 6 | (b0 & 0x80) >> 7;
-		pixels.p6 = (b1 & 0x40) >> 5 | (b0 & 0x40) >> 6;
-		pixels.p5 = (b1 & 0x20) >> 4 | (b0 & 0x20) >> 5;
-		pixels.p4 = (b1 & 0x10) >> 3 | (b0 & 0x10) >> 4;
-		pixels.p3 = (b1 & 0x08) >> 2 | (b0 & 0x08) >> 3;
-		pixels.p2 = (b1 & 0x04) >> 1 | (b0 & 0x04) >> 2;
-		pixels.p1 = (b1 & 0x02) >> 0 | (b0 & 0x02) >> 1;
-		pixels.p0 = (b1 & 0x01) << 1 | (b0 & 0x01) >> 0;
+		MarkAllMapEntriesDirty();
+		mapLayersTileDataSelect = control.BGWindowTileDataSelect;
 	}
-	else
+
+	if (anyTileChanged)
+	{
+		CGBTileAttribute tile_attr;
+
+		for (int entry = 0; entry < NumMapEntries * 2; entry++)
+		{
+			if (!mapEntryDirty[entry] && tileChanged[GetMapEntryTile(entry, tile_attr)])
+				MarkMapEntryDirty(entry);
+		}
+
+		memset(tileChanged, 0, sizeof(tileChanged));
+		anyTileChanged = false;
+	}
+
+	for (int i = 0; i < numDirtyMapEntries; i++)
 	{
-		pixels.p0 = (b1 & 0x80) >> 6 | (b0 & 0x80) >> 7;
-		pixels.p1 = (b1 & 0x40) >> 5 | (b0 & 0x40) >> 6;
-		pixels.p2 = (b1 & 0x20) >> 4 | (b0 & 0x20) >> 5;
-		pixels.p3 = (b1 & 0x10) >> 3 | (b0 & 0x10) >> 4;
-		pixels.p4 = (b1 & 0x08) >> 2 | (b0 & 0x08) >> 3;
-		pixels.p5 = (b1 & 0x04) >> 1 | (b0 & 0x04) >> 2;
-		pixels.p6 = (b1 & 0x02) >> 0 | (b0 & 0x02) >> 1;
-		pixels.p7 = (b1 & 0x01) << 1 | (b0 & 0x01) >> 0;
+		int entry = dirtyMapEntries[i];
+		RenderMapEntry(entry);
+		mapEntryDirty[entry] = false;
 	}
+
+	numDirtyMapEntries = 0;
+}
+
+void GPU::RenderMapEntry(int entry)
+{
+	CGBTileAttribute tile_attr;
+	int tile = GetMapEntryTile(entry, tile_attr);
+	int tile_data_index = (tile % NumTilesPerBank) * 16;
+
+	int layer = entry / NumMapEntries;
+	int map_pos = entry % NumMapEntries;
+	uint8_t* dest = mapLayers + layer * MapLayerSize + (map_pos / 32) * 8 * TileMapWidth + (map_pos % 32) * 8;
+
+	for (int r = 0; r < 8; r++)
+	{
+		int pixel_row = tile_attr.VerticalFlip ? 7 - r : r;
+		const uint8_t* pixels = GetTileRow(tile_data_index + pixel_row * 2, tile_attr.VRAMBank == 1, tile_attr.HorizontalFlip);
+		memcpy(dest + r * TileMapWidth, pixels, 8);
+	}
+
+	mapLayerAttrs[entry] = tile_attr.Palette | (tile_attr.PriorityOverSprites ? AttrPriority : 0);
+}
+
+inline const uint8_t* GPU::GetTileRow(int vram_index, bool read_bank_1, bool horizontal_flip) const
+{
+	// vram_index is the offset of the row's first byte within a bank
+	int cache_index = ((read_bank_1 ? NumTilesPerBank : 0) + (vram_index >> 4)) * 64 + ((vram_index & 0xF) >> 1) * 8;
+	return horizontal_flip ? tileCacheFlipped + cache_index : tileCache + cache_index;
+}
+
+inline bool GPU::IsBlankRow(const uint8_t* row)
+{
+	uint64_t packed;
+	memcpy(&packed, row, sizeof(packed));
+	return packed == 0;
 }
 
 void GPU::WriteRegister(uint16_t addr, uint8_t value)
 {
+	if (accurateMode3)
+	{
+		// Everything that feeds the pixels except FF41 (STAT), FF44-FF46 (LY, LYC, OAM DMA) and the palette indexes
+		if (addr == 0xFF40 || addr == 0xFF42 || addr == 0xFF43 || (addr >= 0xFF47 && addr <= 0xFF4B) || addr == 0xFF69 || addr == 0xFF6B)
+			CatchUpLine();
+	}
+
+	// The rest of the registers the renderer reads are sent along with each line
+	if (renderWorker && addr >= 0xFF68 && addr <= 0xFF6B)
+		renderWorker->LogWrite(RenderWorker::WriteTarget::Register, addr, value);
+
 	switch (addr)
 	{
 		case 0xFF40:
@@ -653,7 +1076,7 @@ void GPU::WriteRegister(uint16_t addr, uint8_t value)
 				if (!dma.HBlankMode)
 				{
 					for (int i = 0; i < dma.Length; i++)
-						vram[dmaDest++] = mmu->ReadByte(dmaSrc++);
+						WriteVRAM(dmaDest++, mmu->ReadByte(dmaSrc++));
 
 					dmaSrc = 0;
 					dmaDest = 0;
@@ -667,14 +1090,22 @@ void GPU::WriteRegister(uint16_t addr, uint8_t value)
 			bgColourPalette.WritePaletteIndex(value);
 			break;
 		case 0xFF69:
+		{
+			int entry_index = bgColourPalette.PaletteIndex / 2;
 			bgColourPalette.WritePaletteData(value);
+			UpdateCorrectedShade(bgColourPalette, entry_index);
 			break;
+		}
 		case 0xFF6A:
 			sprColourPalette.WritePaletteIndex(value);
 			break;
 		case 0xFF6B:
+		{
+			int entry_index = sprColourPalette.PaletteIndex / 2;
 			sprColourPalette.WritePaletteData(value);
+			UpdateCorrectedShade(sprColourPalette, entry_index);
 			break;
+		}
 		default:
 			LOG_VERBOSE("[GPU] WriteRegister: Illegal or unsupported address: %Xh", addr);
 			break;
@@ -748,7 +1179,7 @@ void GPU::WriteByteVRAM(uint16_t addr, uint8_t value)
 		LOG_VIOLATION("Cannot access VRAM during ReadingVRAM(3) mode");
 
 	int relative_addr = vramOffset + (addr & 0x1FFF);
-	vram[relative_addr] = value;
+	WriteVRAM(relative_addr, value);
 }
 
 uint8_t GPU::ReadByteOAM(uint16_t addr)
@@ -792,10 +1223,22 @@ void GPU::WriteDWordOAM(uint16_t addr, uint8_t byte0, uint8_t byte1, uint8_t byt
 	oam[offset + 2] = byte2;
 	oam[offset + 3] = byte3;
 
+	if (renderWorker)
+	{
+		renderWorker->LogWrite(RenderWorker::WriteTarget::OAM, offset + 0, byte0);
+		renderWorker->LogWrite(RenderWorker::WriteTarget::OAM, offset + 1, byte1);
+		renderWorker->LogWrite(RenderWorker::WriteTarget::OAM, offset + 2, byte2);
+		renderWorker->LogWrite(RenderWorker::WriteTarget::OAM, offset + 3, byte3);
+	}
+
 	// Decode the newly updated sprite entry right away
 	int sprite_index = offset / 4;
 	uint16_t base_addr = addr & 0xFFFC;
+	SpriteData previous = sprites[sprite_index];
 	sprites[sprite_index].DecodeFromOAM(base_addr, byte0, byte1, byte2, byte3);
+
+	if (!(sprites[sprite_index] == previous))
+		SpriteChanged();
 }
 
 void GPU::WriteByteOAM(uint16_t addr, uint8_t value)
@@ -808,17 +1251,28 @@ void GPU::WriteByteOAM(uint16_t addr, uint8_t value)
 		throw new exception("OAM index out of range");
 
 	oam[offset] = value;
+
+	if (renderWorker)
+		renderWorker->LogWrite(RenderWorker::WriteTarget::OAM, offset, value);
 	
 	// Decode the newly updated sprite entry right away
 	int sprite_index = offset / 4;
 	uint16_t base_addr = addr & 0xFFFC;
+	SpriteData previous = sprites[sprite_index];
 	sprites[sprite_index].DecodeFromOAM(base_addr, oam.Ptr() + sprite_index * 4);
+
+	if (!(sprites[sprite_index] == previous))
+		SpriteChanged();
 }
 
-void GPU::RenderTilesViz(int tile_set, ColourBuffer* out_buffers, CGBTileAttribute* out_attrs, uint16_t* addrs)
+void GPU::SpriteChanged()
 {
-	static TilePixelRow pixels;
+	spriteLinesDirty = true;
+	videoVersion++;
+}
 
+void GPU::RenderTilesViz(int tile_set, PixelBuffer* out_buffers, CGBTileAttribute* out_attrs, uint16_t* addrs)
+{
 	assert(tile_set == 0 || tile_set == 1 || tile_set == -1);
 
 	uint8_t b0;
@@ -840,7 +1294,7 @@ void GPU::RenderTilesViz(int tile_set, ColourBuffer* out_buffers, CGBTileAttribu
 		CGBTileAttribute& tile_attr = out_attrs[idx];
 		tile_attr.DecodeFromByte(bCGB ? vram[vram_idx] : 0);
 
-		ColourBuffer& viz_buffer = out_buffers[idx];
+		PixelBuffer& viz_buffer = out_buffers[idx];
 
 		addrs[idx] = 0x8000 | vram_idx;
 
@@ -850,46 +1304,29 @@ void GPU::RenderTilesViz(int tile_set, ColourBuffer* out_buffers, CGBTileAttribu
 
 			bool bank_1 = false; //bCGB && tile_attr.VRAMBank == 1;
 			bool hflip = bCGB && tile_attr.HorizontalFlip;
-			ReadPixels(pixels, data_idx, false, false);
+			const uint8_t* pixels = GetTileRow(data_idx, false, false);
 
 			if (bCGB)
 			{
-				viz_buffer[r * 8 + 0] = bgColourPalette.GetColour(tile_attr.Palette, pixels[0]);
-				viz_buffer[r * 8 + 0].Correct(GetColourCorrectionMode(), 1.0f);
-				viz_buffer[r * 8 + 1] = bgColourPalette.GetColour(tile_attr.Palette, pixels[1]);
-				viz_buffer[r * 8 + 1].Correct(GetColourCorrectionMode(), 1.0f);
-				viz_buffer[r * 8 + 2] = bgColourPalette.GetColour(tile_attr.Palette, pixels[2]);
-				viz_buffer[r * 8 + 2].Correct(GetColourCorrectionMode(), 1.0f);
-				viz_buffer[r * 8 + 3] = bgColourPalette.GetColour(tile_attr.Palette, pixels[3]);
-				viz_buffer[r * 8 + 3].Correct(GetColourCorrectionMode(), 1.0f);
-				viz_buffer[r * 8 + 4] = bgColourPalette.GetColour(tile_attr.Palette, pixels[4]);
-				viz_buffer[r * 8 + 4].Correct(GetColourCorrectionMode(), 1.0f);
-				viz_buffer[r * 8 + 5] = bgColourPalette.GetColour(tile_attr.Palette, pixels[5]);
-				viz_buffer[r * 8 + 5].Correct(GetColourCorrectionMode(), 1.0f);
-				viz_buffer[r * 8 + 6] = bgColourPalette.GetColour(tile_attr.Palette, pixels[6]);
-				viz_buffer[r * 8 + 6].Correct(GetColourCorrectionMode(), 1.0f);
-				viz_buffer[r * 8 + 7] = bgColourPalette.GetColour(tile_attr.Palette, pixels[7]);
-				viz_buffer[r * 8 + 7].Correct(GetColourCorrectionMode(), 1.0f);
+				for (int c = 0; c < 8; c++)
+				{
+					GemColour colour = bgColourPalette.GetColour(tile_attr.Palette, pixels[c]);
+					colour.Correct(GetColourCorrectionMode(), 1.0f);
+					viz_buffer.SetPixel(r * 8 + c, colour);
+				}
 			}
 			else
 			{
-				viz_buffer[r * 8 + 0] = bgMonoPalette.GetColour(pixels[0]);
-				viz_buffer[r * 8 + 1] = bgMonoPalette.GetColour(pixels[1]);
-				viz_buffer[r * 8 + 2] = bgMonoPalette.GetColour(pixels[2]);
-				viz_buffer[r * 8 + 3] = bgMonoPalette.GetColour(pixels[3]);
-				viz_buffer[r * 8 + 4] = bgMonoPalette.GetColour(pixels[4]);
-				viz_buffer[r * 8 + 5] = bgMonoPalette.GetColour(pixels[5]);
-				viz_buffer[r * 8 + 6] = bgMonoPalette.GetColour(pixels[6]);
-				viz_buffer[r * 8 + 7] = bgMonoPalette.GetColour(pixels[7]);
+				for (int c = 0; c < 8; c++)
+					viz_buffer.SetPixel(r * 8 + c, bgMonoPalette.GetColour(pixels[c], dmgPalette));
 			}
 		}
 	}
 }
 
-void GPU::RenderSpritesViz(ColourBuffer* out_buffers, SpriteData* out_sprites)
+void GPU::RenderSpritesViz(PixelBuffer* out_buffers, SpriteData* out_sprites)
 {
 	int sprite_height = control.SpriteSize == 0 ? 8 : 16;
-	static TilePixelRow pixels;
 
 	for (int i = 0; i < NumSprites; i++)
 	{
@@ -897,7 +1334,7 @@ void GPU::RenderSpritesViz(ColourBuffer* out_buffers, SpriteData* out_sprites)
 		out_sprites[i] = sprite;
 
 
-		ColourBuffer& curr_tile = out_buffers[i];
+		PixelBuffer& curr_tile = out_buffers[i];
 		curr_tile.Fill(GemColour::White());
 		curr_tile.Width = 8;
 		curr_tile.Height = sprite_height;
@@ -910,14 +1347,8 @@ void GPU::RenderSpritesViz(ColourBuffer* out_buffers, SpriteData* out_sprites)
 		{
 			if (sprite.IsZero)
 			{
-				curr_tile[8 * ln + 0] = GemColour::White();
-				curr_tile[8 * ln + 1] = GemColour::White();
-				curr_tile[8 * ln + 2] = GemColour::White();
-				curr_tile[8 * ln + 3] = GemColour::White();
-				curr_tile[8 * ln + 4] = GemColour::White();
-				curr_tile[8 * ln + 5] = GemColour::White();
-				curr_tile[8 * ln + 6] = GemColour::White();
-				curr_tile[8 * ln + 7] = GemColour::White();
+				for (int c = 0; c < 8; c++)
+					curr_tile.SetPixel(8 * ln + c, GemColour::White());
 			}
 			else
 			{
@@ -938,61 +1369,32 @@ void GPU::RenderSpritesViz(ColourBuffer* out_buffers, SpriteData* out_sprites)
 
 				int tile_data_vram_index = (tile * 16) + (pixel_row * 2);
 
-				uint8_t b0 = 0;
-				uint8_t b1 = 0;
-				if (bCGB && sprite.VRAMBank == 1)
-				{
-					b0 = vram[0x2000 + tile_data_vram_index];
-					b1 = vram[0x2000 + tile_data_vram_index + 1];
-				}
-				else
-				{
-					b0 = vram[tile_data_vram_index];
-					b1 = vram[tile_data_vram_index + 1];
-				}
+				const uint8_t* pixels = GetTileRow(tile_data_vram_index, bCGB && sprite.VRAMBank == 1, false);
 
 				// Early out for colour number 0 which is always transparent
-				if (b0 == 0 && b1 == 0)
+				if (IsBlankRow(pixels))
 					continue;
 
-				DecodePixels(pixels, b0, b1, false);
-
 				if (bCGB)
 				{
-					curr_tile[8 * ln + 0] = sprColourPalette.GetColour(sprite.CGBPalette, pixels[0]);
-					curr_tile[8 * ln + 0].Correct(GetColourCorrectionMode(), 1.0f);
-					curr_tile[8 * ln + 1] = sprColourPalette.GetColour(sprite.CGBPalette, pixels[1]);
-					curr_tile[8 * ln + 1].Correct(GetColourCorrectionMode(), 1.0f);
-					curr_tile[8 * ln + 2] = sprColourPalette.GetColour(sprite.CGBPalette, pixels[2]);
-					curr_tile[8 * ln + 2].Correct(GetColourCorrectionMode(), 1.0f);
-					curr_tile[8 * ln + 3] = sprColourPalette.GetColour(sprite.CGBPalette, pixels[3]);
-					curr_tile[8 * ln + 3].Correct(GetColourCorrectionMode(), 1.0f);
-					curr_tile[8 * ln + 4] = sprColourPalette.GetColour(sprite.CGBPalette, pixels[4]);
-					curr_tile[8 * ln + 4].Correct(GetColourCorrectionMode(), 1.0f);
-					curr_tile[8 * ln + 5] = sprColourPalette.GetColour(sprite.CGBPalette, pixels[5]);
-					curr_tile[8 * ln + 5].Correct(GetColourCorrectionMode(), 1.0f);
-					curr_tile[8 * ln + 6] = sprColourPalette.GetColour(sprite.CGBPalette, pixels[6]);
-					curr_tile[8 * ln + 6].Correct(GetColourCorrectionMode(), 1.0f);
-					curr_tile[8 * ln + 7] = sprColourPalette.GetColour(sprite.CGBPalette, pixels[7]);
-					curr_tile[8 * ln + 7].Correct(GetColourCorrectionMode(), 1.0f);
+					for (int c = 0; c < 8; c++)
+					{
+						GemColour colour = sprColourPalette.GetColour(sprite.CGBPalette, pixels[c]);
+						colour.Correct(GetColourCorrectionMode(), 1.0f);
+						curr_tile.SetPixel(8 * ln + c, colour);
+					}
 				}
 				else
 				{
-					curr_tile[8 * ln + 0] = sprMonoPalettes[sprite.DMGPalette].GetColour(pixels[0]);
-					curr_tile[8 * ln + 1] = sprMonoPalettes[sprite.DMGPalette].GetColour(pixels[1]);
-					curr_tile[8 * ln + 2] = sprMonoPalettes[sprite.DMGPalette].GetColour(pixels[2]);
-					curr_tile[8 * ln + 3] = sprMonoPalettes[sprite.DMGPalette].GetColour(pixels[3]);
-					curr_tile[8 * ln + 4] = sprMonoPalettes[sprite.DMGPalette].GetColour(pixels[4]);
-					curr_tile[8 * ln + 5] = sprMonoPalettes[sprite.DMGPalette].GetColour(pixels[5]);
-					curr_tile[8 * ln + 6] = sprMonoPalettes[sprite.DMGPalette].GetColour(pixels[6]);
-					curr_tile[8 * ln + 7] = sprMonoPalettes[sprite.DMGPalette].GetColour(pixels[7]);
+					for (int c = 0; c < 8; c++)
+						curr_tile.SetPixel(8 * ln + c, sprMonoPalettes[sprite.DMGPalette].GetColour(pixels[c], dmgPalette));
 				}
 			}
 		}
 	}
 }
 
-void GPU::RenderPalettesViz(ColourBuffer* out_buffers, ColourPalette::PaletteEntry* out_entries)
+void GPU::RenderPalettesViz(PixelBuffer* out_buffers, ColourPalette::PaletteEntry* out_entries)
 {
 	for (int idx = 0; idx < NumPaletteColours; idx++)
 	{
@@ -1005,68 +1407,6 @@ void GPU::RenderPalettesViz(ColourBuffer* out_buffers, ColourPalette::PaletteEnt
 	}
 }
 
-//////////////////////////////
-///     Tile Pixel Row     ///
-//////////////////////////////
-
-TilePixelRow::TilePixelRow()
-{
-}
-
-TilePixelRow::TilePixelRow(const int* arr)
-{
-	p0 = arr[0];
-	p1 = arr[1];
-	p2 = arr[2];
-	p3 = arr[3];
-	p4 = arr[4];
-	p5 = arr[5];
-	p6 = arr[6];
-	p7 = arr[7];
-}
-
-uint8_t* TilePixelRow::Ptr()
-{
-	return reinterpret_cast<uint8_t*>(this);
-}
-
-uint8_t TilePixelRow::operator[](int index)
-{
-	switch (index)
-	{
-	case 0:
-		return p0;
-	case 1:
-		return p1;
-	case 2:
-		return p2;
-	case 3:
-		return p3;
-	case 4:
-		return p4;
-	case 5:
-		return p5;
-	case 6:
-		return p6;
-	case 7:
-		return p7;
-	}
-
-	throw std::exception("Invalid index");
-}
-
-void TilePixelRow::CopyToArray(int* arr)
-{
-	arr[0] = p0;
-	arr[1] = p1;
-	arr[2] = p2;
-	arr[3] = p3;
-	arr[4] = p4;
-	arr[5] = p5;
-	arr[6] = p6;
-	arr[7] = p7;
-}
-
 /*
 Rough explanation of how graphics data is arranged and rendered:
 
@@ -141,10 +141,7 @@ void LCDPositions::Reset(bool bCGB)
 MonochromePalette::MonochromePalette()
 	: BgPaletteRegisterByte(0)
 {
-	PalettePtrs[3] = const_cast<GemColour*>(&(GemPalette::Black()));
-	PalettePtrs[2] = const_cast<GemColour*>(&(GemPalette::DarkGrey()));
-	PalettePtrs[1] = const_cast<GemColour*>(&(GemPalette::LightGrey()));
-	PalettePtrs[0] = const_cast<GemColour*>(&(GemPalette::White()));
+	memset(BGPalette, 0, sizeof(BGPalette));
 }
 
 void MonochromePalette::WriteBgPalette(uint8_t value)
@@ -161,10 +158,9 @@ uint8_t MonochromePalette::ReadBgPalette()
 	return BgPaletteRegisterByte;
 }
 
-const GemColour& MonochromePalette::GetColour(uint8_t colour_number)
+const GemColour& MonochromePalette::GetColour(uint8_t colour_number, const GemPalette& shades) const
 {
-	int index = BGPalette[colour_number];
-	return *PalettePtrs[index];
+	return shades.GetColour(BGPalette[colour_number]);
 }
 
 
@@ -353,6 +349,20 @@ void SpriteData::DecodeFromOAM(uint16_t addr, uint8_t byte0, uint8_t byte1, uint
 	IsZero = byte0 == 0 && byte1 == 0 && byte2 == 0 && byte3 == 0;
 }
 
+bool SpriteData::operator==(const SpriteData& other) const
+{
+	return YPos == other.YPos
+		&& XPos == other.XPos
+		&& Tile == other.Tile
+		&& BehindBG == other.BehindBG
+		&& VerticalFlip == other.VerticalFlip
+		&& HorizontalFlip == other.HorizontalFlip
+		&& DMGPalette == other.DMGPalette
+		&& VRAMBank == other.VRAMBank
+		&& CGBPalette == other.CGBPalette
+		&& IsZero == other.IsZero;
+}
+
 //////////////////////////////
 /// VRAM DMA Transfer Reg. ///
 //////////////////////////////
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
 #include <fstream>
@@ -16,7 +17,9 @@ Gem::Gem()
 	, traceFile(nullptr)
 	, tickCount(0)
 	, frameCount(0)
-	, tickAPU(true)
+	, cycleCount(0)
+	, audioOnly(false)
+	, vblankTCycles(0)
 	, isTracing(false)
 {
 	cpu.SetMMU(mmu);
@@ -28,6 +31,8 @@ Gem::Gem()
 	gpu->SetMMU(mmu);
 
 	joypad->SetInterruptController(mmu->GetInterruptController());
+
+	SelectModePath();
 }
 
 Gem::~Gem()
@@ -44,23 +49,56 @@ void Gem::Reset(bool bCGB)
 
 	tickCount = 0;
 	frameCount = 0;
+	cycleCount = 0;
+	vblankTCycles = 0;
+
+	SelectModePath();
 
 	if (isTracing)
 		EndTrace();
 }
 
+shared_ptr<Gem> Gem::Fork()
+{
+	shared_ptr<Gem> child = make_shared<Gem>();
+
+	child->cart = cart;
+	child->bCGB = bCGB;
+	child->tickCount = tickCount;
+	child->frameCount = frameCount;
+	child->cycleCount = cycleCount;
+	child->audioOnly = audioOnly;
+	child->vblankTCycles = vblankTCycles;
+
+	child->cpu.ForkFrom(cpu);
+	child->mmu->ForkFrom(*mmu);
+	child->gpu->ForkFrom(*gpu);
+	child->apu->ForkFrom(*apu);
+	child->joypad->ForkFrom(*joypad);
+
+	child->SelectModePath();
+	return child;
+}
+
 void Gem::Shutdown()
 {
 	
 }
 
 void Gem::LoadRom(const char* file)
+{
+	shared_ptr<CartridgeReader> rom = make_shared<CartridgeReader>();
+	rom->LoadFile(file);
+
+	LoadRom(rom);
+}
+
+void Gem::LoadRom(shared_ptr<CartridgeReader> rom)
 {
 	if (cart)
 		cart.reset();
 
-	cart = make_shared<CartridgeReader>();
-	cart->LoadFile(file);
+	cart = rom;
 
 	if (!mmu->SetCartridge(cart))
 	{
@@ -72,7 +110,14 @@ void Gem::LoadRom(const char* file)
 
 void Gem::ToggleSound(bool enabled)
 {
-	tickAPU = enabled;
+	apu->SetSilent(!enabled);
+}
+
+void Gem::SetAudioOnly(bool enabled)
+{
+	audioOnly = enabled;
+	vblankTCycles = 0;
+	SelectModePath();
 }
 
 void Gem::TickUntilVBlank()
@@ -80,7 +125,21 @@ void Gem::TickUntilVBlank()
 	while (Tick() == false);
 }
 
+void Gem::SelectModePath()
+{
+	if (audioOnly)
+		tickFunc = bCGB ? &Gem::TickMode<true, false> : &Gem::TickMode<false, false>;
+	else
+		tickFunc = bCGB ? &Gem::TickMode<true, true> : &Gem::TickMode<false, true>;
+}
+
 bool Gem::Tick()
+{
+	return (this->*tickFunc)();
+}
+
+template<bool CGB, bool Video>
+bool Gem::TickMode()
 {
 	/** FETCH */
 	// In case inst == 0xCB the Z80 class will read the next byte on its own to finish the opcode
@@ -99,6 +158,19 @@ bool Gem::Tick()
 	{
 		// Without this a timer interrupt would never occur in the idle state.
 		m_op = 1;
+
+		// With no video to keep in step, a halted CPU can skip straight to the next VBlank or timer interrupt
+		// (once the one that woke it has been serviced)
+		if constexpr (!Video)
+		{
+			if (mmu->GetInterruptController()->ReadPendingInterrupts() == 0)
+			{
+				int t_mult = CGB && mmu->GetCGBRegisters().Speed() == SpeedMode::Double ? 2 : 4;
+				int until_vblank = (GemConstants::TCyclesPerFrame - vblankTCycles - 1) / t_mult + 1;
+				int until_timer = (mmu->GetTimerController().TCyclesUntilOverflow() - 1) / 4 + 1;
+				m_op = max(1, min(until_vblank, until_timer));
+			}
+		}
 	}
 
 	/** INTERRUPTS */
@@ -107,24 +179,41 @@ bool Gem::Tick()
 	/** TIMERS */
 	mmu->GetTimerController().TickTimers(m_op * 4);
 
-	int t_mult = bCGB && mmu->GetCGBRegisters().Speed() == SpeedMode::Double
-					? 2 : 4;
-
-	/** APU */
-	if (tickAPU)
+	// The CPU runs at double speed relative to the GPU and APU after a CGB speed switch
+	int t_mult = 4;
+	if constexpr (CGB)
 	{
-		// Tick the APU so it can fill its sound buffer
-		apu->TickEmitters(m_op * t_mult);
+		if (mmu->GetCGBRegisters().Speed() == SpeedMode::Double)
+			t_mult = 2;
 	}
 
+	/** APU */
+	// Tick the APU so it can fill its sound buffer (or just its registers when silent)
+	apu->TickEmitters(m_op * t_mult);
+
 	/** GPU */
-	// Tick the GPU's internal state with the m cycles
-	LCDMode prev = gpu->GetLCDStatus().Mode;
-	gpu->TickStateMachine(m_op * t_mult);
-	bool vblank = gpu->GetLCDStatus().Mode != prev
+	bool vblank = false;
+	if constexpr (Video)
+	{
+		// Tick the GPU's internal state with the m cycles
+		LCDMode prev = gpu->GetLCDStatus().Mode;
+		gpu->TickStateMachine(m_op * t_mult);
+		vblank = gpu->GetLCDStatus().Mode != prev
 					&& gpu->GetLCDStatus().Mode == LCDMode::VBlank;
+	}
+	else
+	{
+		vblankTCycles += m_op * t_mult;
+		if (vblankTCycles >= GemConstants::TCyclesPerFrame)
+		{
+			vblankTCycles -= GemConstants::TCyclesPerFrame;
+			mmu->GetInterruptController()->VBlankRequested = true;
+			vblank = true;
+		}
+	}
 
 	tickCount++;
+	cycleCount += m_op * 4;
 	if (vblank) frameCount++;
 
 	return vblank;
@@ -154,22 +243,18 @@ inline void Gem::HandleTracing(uint16_t pc, uint16_t inst)
 	if (!isTracing)
 		return;
 
-	OpCodeInfo* inst_info = nullptr;
-
-	if (inst != 0xCB)
-	{
-		inst_info = &OpCodeIndex::Get()[inst];
-	}
-	else
+	if (inst == 0xCB)
 	{
 		uint8_t extended = mmu->ReadByte(pc + 1);
 		inst = 0xCB00 | extended;
-		inst_info = &OpCodeIndex::Get()[inst];
 	}
 
+	const OpCodeInfo& inst_info = GetOpCodeInfo(inst);
+	const char* mnemonic = inst_info.IsValid() ? inst_info.Mnemonic : "???";
+
 	*traceFile << std::hex << std::uppercase
-		<< "PC:" << setw(4) << setfill('0') << cpu.GetPC() << setfill(' ') << " (" << setw(10) << inst_info->Mnemonic << ")"
-		<< " SP:" << setw(4) << setfill('0') << cpu.GetSP() << "(" << setw(10) << inst_info->Mnemonic << ")"
+		<< "PC:" << setw(4) << setfill('0') << cpu.GetPC() << setfill(' ') << " (" << setw(10) << mnemonic << ")"
+		<< " SP:" << setw(4) << setfill('0') << cpu.GetSP() << "(" << setw(10) << mnemonic << ")"
 		<< " A:" << setw(2) << setfill('0') << unsigned(cpu.GetRegisterA())
 		<< " B:" << setw(2) << setfill('0') << unsigned(cpu.GetRegisterB())
 		<< " C:" << setw(2) << setfill('0') << unsigned(cpu.GetRegisterC())
@@ -0,0 +1,315 @@
+#include <algorithm>
+
+#include "Core/GemBatch.h"
+#include "Logging.h"
+
+using namespace std;
+
+/////////////////////////////
+//     WorkStealingPool    //
+/////////////////////////////
+
+WorkStealingPool::WorkStealingPool(int num_threads)
+	: numThreads(max(num_threads, 1))
+	, currentJob(nullptr)
+	, pendingJobs(0)
+	, generation(0)
+	, shutdown(false)
+{
+	for (int i = 0; i < numThreads; i++)
+		queues.push_back(make_unique<WorkQueue>());
+
+	// Worker 0 is whichever thread calls Run()
+	for (int i = 1; i < numThreads; i++)
+		threads.emplace_back(&WorkStealingPool::WorkerLoop, this, i);
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+	{
+		lock_guard<mutex> guard(stateLock);
+		shutdown = true;
+	}
+
+	startSignal.notify_all();
+
+	for (thread& t : threads)
+		t.join();
+}
+
+void WorkStealingPool::Run(int num_jobs, const function<void(int)>& job)
+{
+	if (num_jobs <= 0)
+		return;
+
+	currentJob = &job;
+	pendingJobs = num_jobs;
+
+	for (int i = 0; i < num_jobs; i++)
+	{
+		WorkQueue& queue = *queues[i % numThreads];
+		lock_guard<mutex> guard(queue.Lock);
+		queue.Jobs.push_back(i);
+	}
+
+	{
+		lock_guard<mutex> guard(stateLock);
+		generation++;
+	}
+
+	startSignal.notify_all();
+
+	DrainQueues(0);
+
+	unique_lock<mutex> guard(stateLock);
+	doneSignal.wait(guard, [this] { return pendingJobs == 0; });
+	currentJob = nullptr;
+
+	// Surface the first failure on the calling thread rather than letting it terminate a worker
+	if (jobError)
+	{
+		exception_ptr error = jobError;
+		jobError = nullptr;
+		rethrow_exception(error);
+	}
+}
+
+void WorkStealingPool::WorkerLoop(int worker)
+{
+	uint64_t seen = 0;
+
+	while (true)
+	{
+		{
+			unique_lock<mutex> guard(stateLock);
+			startSignal.wait(guard, [&] { return shutdown || generation != seen; });
+
+			if (shutdown)
+				return;
+
+			seen = generation;
+		}
+
+		DrainQueues(worker);
+	}
+}
+
+void WorkStealingPool::DrainQueues(int worker)
+{
+	int job;
+	while (PopJob(worker, job))
+	{
+		try
+		{
+			(*currentJob)(job);
+		}
+		catch (...)
+		{
+			lock_guard<mutex> guard(stateLock);
+			if (!jobError)
+				jobError = current_exception();
+		}
+
+		if (--pendingJobs == 0)
+		{
+			// Take the lock so the notify can't slip in between Run() checking the count and going to sleep
+			lock_guard<mutex> guard(stateLock);
+			doneSignal.notify_all();
+		}
+	}
+}
+
+bool WorkStealingPool::PopJob(int worker, int& job)
+{
+	{
+		WorkQueue& own = *queues[worker];
+		lock_guard<mutex> guard(own.Lock);
+		if (!own.Jobs.empty())
+		{
+			job = own.Jobs.front();
+			own.Jobs.pop_front();
+			return true;
+		}
+	}
+
+	for (int i = 1; i < numThreads; i++)
+	{
+		WorkQueue& victim = *queues[(worker + i) % numThreads];
+		lock_guard<mutex> guard(victim.Lock);
+		if (!victim.Jobs.empty())
+		{
+			job = victim.Jobs.back();
+			victim.Jobs.pop_back();
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/////////////////////////////
+//         GemBatch        //
+/////////////////////////////
+
+GemBatch::GemBatch(int num_instances, int num_threads)
+	: numInstances(num_instances)
+	, pool(num_threads > 0 ? num_threads : max(int(thread::hardware_concurrency()), 1))
+	, inputs(num_instances, true)
+	, appliedInputs(num_instances, true)
+	, cycleTargets(num_instances, true)
+	, frameBuffers(num_instances * FrameBufferStride, true)
+	, rewards(num_instances, true)
+	, ramViewAddr(0)
+	, ramViewSize(0)
+{
+	if (num_instances <= 0)
+		throw exception("GemBatch needs at least one instance");
+
+	for (int i = 0; i < numInstances; i++)
+	{
+		shared_ptr<Gem> gem = make_shared<Gem>();
+
+		// Nothing drains the sample buffer of a batched instance so it only keeps the sound registers up to date
+		gem->ToggleSound(false);
+		instances.push_back(gem);
+	}
+
+	inputs.Fill(0);
+	appliedInputs.Fill(0);
+	cycleTargets.Fill(0);
+	frameBuffers.Fill(0);
+	rewards.Fill(0.0f);
+}
+
+GemBatch::~GemBatch()
+{
+}
+
+void GemBatch::LoadRom(const char* file)
+{
+	sharedRom = make_shared<CartridgeReader>();
+	sharedRom->LoadFile(file);
+
+	for (shared_ptr<Gem>& gem : instances)
+		gem->LoadRom(sharedRom);
+}
+
+void GemBatch::LoadRom(int index, const char* file)
+{
+	instances[index]->LoadRom(file);
+}
+
+void GemBatch::Reset(bool bCGB)
+{
+	pool.Run(numInstances, [&](int i)
+	{
+		Gem& gem = *instances[i];
+		gem.Reset(bCGB);
+
+		for (int key = 0; key < 8; key++)
+			gem.GetJoypad()->Release(static_cast<JoypadKey>(key));
+
+		appliedInputs[i] = 0;
+		cycleTargets[i] = 0;
+		CaptureOutputs(i);
+	});
+}
+
+void GemBatch::StepFrames(int frames)
+{
+	pool.Run(numInstances, [&](int i)
+	{
+		Gem& gem = *instances[i];
+		ApplyInputs(i);
+
+		for (int f = 0; f < frames; f++)
+			gem.TickUntilVBlank();
+
+		cycleTargets[i] = gem.GetCycleCount();
+		CaptureOutputs(i);
+	});
+}
+
+void GemBatch::StepCycles(uint64_t t_cycles)
+{
+	pool.Run(numInstances, [&](int i)
+	{
+		Gem& gem = *instances[i];
+		ApplyInputs(i);
+
+		cycleTargets[i] += t_cycles;
+		while (gem.GetCycleCount() < cycleTargets[i])
+			gem.Tick();
+
+		CaptureOutputs(i);
+	});
+}
+
+void GemBatch::SetFrameSkip(int frames)
+{
+	for (shared_ptr<Gem>& gem : instances)
+		gem->GetGPU()->SetFrameSkip(frames);
+}
+
+void GemBatch::SetRAMView(uint16_t addr, int size)
+{
+	if (size < 0 || addr + size > 0x10000)
+		throw exception("RAM view is out of range");
+
+	ramViewAddr = addr;
+	ramViewSize = size;
+
+	ramViews.Free();
+	if (size > 0)
+	{
+		ramViews = DArray<uint8_t>(numInstances * size, true);
+		ramViews.Fill(0);
+	}
+}
+
+void GemBatch::ApplyInputs(int index)
+{
+	uint8_t held = inputs[index];
+	uint8_t changed = held ^ appliedInputs[index];
+	if (changed == 0)
+		return;
+
+	shared_ptr<Joypad> joypad = instances[index]->GetJoypad();
+	for (int key = 0; key < 8; key++)
+	{
+		if ((changed & (1 << key)) == 0)
+			continue;
+
+		if (held & (1 << key))
+			joypad->Press(static_cast<JoypadKey>(key));
+		else
+			joypad->Release(static_cast<JoypadKey>(key));
+	}
+
+	appliedInputs[index] = held;
+}
+
+void GemBatch::CaptureOutputs(int index)
+{
+	Gem& gem = *instances[index];
+
+	const PixelBuffer& fb = gem.GetGPU()->GetFrameBuffer();
+	uint8_t* out = frameBuffers.Ptr() + index * FrameBufferStride;
+	for (uint32_t i = 0; i < fb.Count(); i++)
+	{
+		GemColour px = GemColour::Unpack(fb[i], fb.Format);
+		*out++ = px.Red;
+		*out++ = px.Green;
+		*out++ = px.Blue;
+	}
+
+	if (ramViewSize > 0)
+	{
+		shared_ptr<MMU> mmu = gem.GetMMU();
+		uint8_t* ram = ramViews.Ptr() + index * ramViewSize;
+		for (int i = 0; i < ramViewSize; i++)
+			ram[i] = mmu->ReadByte(ramViewAddr + i);
+	}
+
+	rewards[index] = rewardFunc ? rewardFunc(gem, index) : 0.0f;
+}
@@ -23,6 +23,13 @@ void Joypad::SetInterruptController(std::shared_ptr<InterruptController> ptr)
 	interrupts = ptr;
 }
 
+void Joypad::ForkFrom(const Joypad& parent)
+{
+	shared_ptr<InterruptController> own_interrupts = interrupts;
+	*this = parent;
+	interrupts = own_interrupts;
+}
+
 void Joypad::Press(JoypadKey key)
 {
 	int key_index = static_cast<int>(key);
@@ -15,10 +15,10 @@ MBC::MBC()
 	lastLatchedTime = {0};
 	Reset();
 
-	extRAMBanks[0] = DArray<uint8_t>(RAMBankSize);
-	extRAMBanks[1] = DArray<uint8_t>(RAMBankSize);
-	extRAMBanks[2] = DArray<uint8_t>(RAMBankSize);
-	extRAMBanks[3] = DArray<uint8_t>(RAMBankSize);
+	extRAMBanks[0] = CowBuffer(RAMBankSize);
+	extRAMBanks[1] = CowBuffer(RAMBankSize);
+	extRAMBanks[2] = CowBuffer(RAMBankSize);
+	extRAMBanks[3] = CowBuffer(RAMBankSize);
 }
 
 void MBC::Reset()
@@ -61,10 +61,7 @@ void MBC::SetCartridge(std::shared_ptr<CartridgeReader> ptr)
 		for (int i = 0; i < cp.NumRAMBanks; i++)
 		{
 			if (!extRAMBanks[i].IsAllocated())
-			{
 				extRAMBanks[i].Allocate();
-				extRAMBanks[i].Reserve();
-			}
 		}
 	}
 }
@@ -84,10 +81,12 @@ bool MBC::SaveExternalRAM(ofstream& fout, streamsize& write_count)
 	curr = cp.NumRAMBanks;
 	WRITE(&curr, 1)
 
+	uint8_t bank_data[RAMBankSize];
 	for (int i = 0; i < cp.NumRAMBanks; i++)
 	{
 		assert(extRAMBanks[i].IsAllocated());
-		WRITE(extRAMBanks[i].Ptr(), extRAMBanks[i].Size());
+		extRAMBanks[i].CopyTo(bank_data);
+		WRITE(bank_data, RAMBankSize);
 	}
 
 	return true;
@@ -121,13 +120,14 @@ bool MBC::LoadExternalRAM(ifstream& input, streamsize& read_count)
 		return false;
 	}
 
+	uint8_t bank_data[RAMBankSize];
 	for (int i = 0; i < cp.NumRAMBanks; i++)
 	{
 		if (!extRAMBanks[i].IsAllocated())
 			extRAMBanks[i].Allocate();
 
-		extRAMBanks[i].Reserve();
-		READ(extRAMBanks[i].Ptr(), RAMBankSize)
+		READ(bank_data, RAMBankSize)
+		extRAMBanks[i].CopyFrom(bank_data);
 	}
 
 	return true;
@@ -211,28 +211,22 @@ void MBC::UpdateRTCRegisters()
 
 uint8_t MBC::ReadByteExtRAM(uint16_t addr)
 {
-	DArray<uint8_t>& bank = extRAMBanks[extRAMBank];
+	CowBuffer& bank = extRAMBanks[extRAMBank];
 
 	if (!bank.IsAllocated())
-	{
 		bank.Allocate();
-		bank.Reserve();
-	}
 
 	return bank[addr & 0x1FFF];
 }
 
 void MBC::WriteByteExtRAM(uint16_t addr, uint8_t value)
 {
-	DArray<uint8_t>& bank = extRAMBanks[extRAMBank];
+	CowBuffer& bank = extRAMBanks[extRAMBank];
 
 	if (!bank.IsAllocated())
-	{
 		bank.Allocate();
-		bank.Reserve();
-	}
 
-	bank[addr & 0x1FFF] = value;
+	bank.Write(addr & 0x1FFF, value);
 }
 
 uint8_t MBC::ReadByte(uint16_t addr)
@@ -9,6 +9,7 @@ using namespace std;
 
 MMU::MMU() 
 	: interrupts(new InterruptController())
+	, bCGB(false)
 	, evalBreakpoints(false)
 	, readBreakpoints(nullptr)
 	, writeBreakpoints(nullptr)
@@ -17,7 +18,9 @@ MMU::MMU()
 	memset(hram, 0, 127);
 
 	for (int i = 0; i < 8; i++)
-		wramBanks[i] = DArray<uint8_t>(WRAMBankSize);
+		wramBanks[i] = CowBuffer(WRAMBankSize);
+
+	SelectModePath();
 }
 
 void MMU::Reset(bool bCGB)
@@ -28,17 +31,37 @@ void MMU::Reset(bool bCGB)
 	for (int i = 0; i < 8; i++)
 	{
 		if (!wramBanks[i].IsAllocated())
-		{
 			wramBanks[i].Allocate();
-			wramBanks[i].Reserve();
-		}
 		else
-		{
 			wramBanks[i].Fill(0);
-		}
 	}
 
 	mbc.Reset();
+
+	SelectModePath();
+}
+
+void MMU::ForkFrom(const MMU& parent)
+{
+	shared_ptr<InterruptController> own_interrupts = interrupts;
+	shared_ptr<GPU> own_gpu = gpu;
+	shared_ptr<APU> own_apu = apu;
+	shared_ptr<Joypad> own_joypad = joypad;
+
+	*this = parent;
+
+	interrupts = own_interrupts;
+	*interrupts = *parent.interrupts;
+	timer.SetInterruptController(interrupts);
+
+	gpu = own_gpu;
+	apu = own_apu;
+	joypad = own_joypad;
+
+	// Breakpoints belong to whoever is debugging the parent
+	readBreakpoints = nullptr;
+	writeBreakpoints = nullptr;
+	evalBreakpoints = false;
 }
 
 bool MMU::SetCartridge(std::shared_ptr<CartridgeReader> ptr)
@@ -73,40 +96,73 @@ void MMU::SetJoypad(std::shared_ptr<Joypad> ptr)
 	joypad = ptr;
 }
 
+void MMU::SelectModePath()
+{
+	if (bCGB)
+	{
+		readWorkingRam = &MMU::ReadWorkingRam<true>;
+		writeWorkingRam = &MMU::WriteWorkingRam<true>;
+	}
+	else
+	{
+		readWorkingRam = &MMU::ReadWorkingRam<false>;
+		writeWorkingRam = &MMU::WriteWorkingRam<false>;
+	}
+}
+
 void MMU::WriteByteWorkingRam(uint16_t addr, bool bank0, uint8_t value)
+{
+	(this->*writeWorkingRam)(addr, bank0, value);
+}
+
+uint8_t MMU::ReadByteWorkingRam(uint16_t addr, bool bank0)
+{
+	return (this->*readWorkingRam)(addr, bank0);
+}
+
+template<bool CGB>
+void MMU::WriteWorkingRam(uint16_t addr, bool bank0, uint8_t value)
 {
 	int bank_num = 0;
 	if (!bank0)
-		bank_num = bCGB ? cgb_state.GetWorkingRamBank() : 1;
+	{
+		// DMG has a fixed second bank, only CGB can switch it
+		if constexpr (CGB)
+			bank_num = cgb_state.GetWorkingRamBank();
+		else
+			bank_num = 1;
+	}
 
 	if (bank_num >= WRAMBanks)
 		throw exception("Working RAM bank index is too large");
 
-	DArray<uint8_t>& bank = wramBanks[bank_num];
+	CowBuffer& bank = wramBanks[bank_num];
 	if (!bank.IsAllocated())
-	{
 		bank.Allocate();
-		bank.Reserve();
-	}
 
-	bank[addr & 0xFFF] = value;
+	bank.Write(addr & 0xFFF, value);
 }
 
-uint8_t MMU::ReadByteWorkingRam(uint16_t addr, bool bank0)
+template<bool CGB>
+uint8_t MMU::ReadWorkingRam(uint16_t addr, bool bank0)
 {
 	int bank_num = 0;
 	if (bank0 == false)
-		bank_num = bCGB ? cgb_state.GetWorkingRamBank() : 1;
+	{
+		if constexpr (CGB)
+			bank_num = cgb_state.GetWorkingRamBank();
+		else
+			bank_num = 1;
+	}
 
 	if (bank_num >= WRAMBanks)
 		throw exception("Working RAM bank index is too large");
 
-	DArray<uint8_t>& bank = wramBanks[bank_num];
+	CowBuffer& bank = wramBanks[bank_num];
 	if (!bank.IsAllocated())
 	{
 		// Allocation probably wouldn't happen on a read, but just in case...
 		bank.Allocate();
-		bank.Reserve();
 	}
 
 	return bank[addr & 0xFFF];
@@ -302,7 +358,7 @@ uint16_t MMU::ReadWord(uint16_t addr)
 
 void MMU::WriteByte(uint16_t addr, uint8_t value)
 {
-	static string device_name; // Used to log a message at the end of this function
+	[[maybe_unused]] const char* device_name = ""; // Used to log a message at the end of this function, unless LOG_VERBOSE is compiled out
 
 	switch (addr & 0xF000)
 	{
@@ -464,7 +520,7 @@ void MMU::WriteByte(uint16_t addr, uint8_t value)
 			break;
 	}
 
-	LOG_VERBOSE("[MMU] %s[%Xh] = %d", device_name.c_str(), addr, value);
+	LOG_VERBOSE("[MMU] %s[%Xh] = %d", device_name, addr, value);
 
 	if (evalBreakpoints && writeBreakpoints)
 	{
@@ -0,0 +1,265 @@
+#include <algorithm>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#include <immintrin.h>
+
+#include "Core/PixelKernels.h"
+#include "Core/GPU.h"
+
+// MSVC lets any function use AVX2 intrinsics, GCC and Clang have to be told per function
+#ifdef _MSC_VER
+#define GEM_TARGET_AVX2
+#else
+#define GEM_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+using namespace std;
+
+namespace PixelKernels
+{
+	static const uint8_t AttrColourNumber = GPU::AttrColourNumber;
+	static const uint8_t AttrPriority = GPU::AttrPriority;
+
+	static void CompositeScalar(uint32_t* dest, uint8_t* dest_attrs, const uint8_t* pixels, int count, const uint32_t* shades, uint8_t priority)
+	{
+		for (int i = 0; i < count; i++)
+		{
+			dest[i] = shades[pixels[i]];
+			dest_attrs[i] = pixels[i] | priority;
+		}
+	}
+
+	// Merges sprite pixels into the frame, accounting for some extra rules when it comes to
+	// rendering sprites in relation to the BG.
+	// 1. Sprite pixels with colour 0 are invisible.
+	// 2. In CGB mode BG tiles can have absolute priority over sprites
+	// 3. Sprites can be above or behind the BG. If they are behind the BG, they will still 
+	//    appear above BG pixels that were coloured with 0.
+	// 4. Colour 0 is always painted over by a sprite
+	static void MergeSpriteScalar(uint32_t* dest, uint8_t* dest_attrs, const uint8_t* pixels, int count, const uint32_t* shades, bool behind_bg, bool force)
+	{
+		for (int i = 0; i < count; i++)
+		{
+			uint8_t colour_number = pixels[i];
+			uint8_t attrs = dest_attrs[i];
+			uint8_t under = attrs & AttrColourNumber;
+
+			if (colour_number == 0 || ((attrs & AttrPriority) && under != 0))
+				continue;
+
+			if (force || !behind_bg || under == 0)
+			{
+				dest[i] = shades[colour_number];
+				dest_attrs[i] = (attrs & AttrPriority) | colour_number;
+			}
+		}
+	}
+
+	// SSE2 has no variable shuffle, so the 4 shades are picked with two rounds of masked selects:
+	// bit 0 of the colour number chooses within each pair and bit 1 between the pairs.
+	struct ShadesSSE2
+	{
+		__m128i S0, D01, S2, D23;
+
+		ShadesSSE2(const uint32_t* shades)
+		{
+			S0 = _mm_set1_epi32(int(shades[0]));
+			S2 = _mm_set1_epi32(int(shades[2]));
+			D01 = _mm_xor_si128(S0, _mm_set1_epi32(int(shades[1])));
+			D23 = _mm_xor_si128(S2, _mm_set1_epi32(int(shades[3])));
+		}
+
+		// 'numbers' holds 4 colour numbers, one per 32-bit lane
+		__m128i Lookup(__m128i numbers) const
+		{
+			__m128i bit0 = _mm_srai_epi32(_mm_slli_epi32(numbers, 31), 31);
+			__m128i bit1 = _mm_srai_epi32(_mm_slli_epi32(numbers, 30), 31);
+			__m128i low = _mm_xor_si128(S0, _mm_and_si128(D01, bit0));
+			__m128i high = _mm_xor_si128(S2, _mm_and_si128(D23, bit0));
+			return _mm_xor_si128(low, _mm_and_si128(_mm_xor_si128(low, high), bit1));
+		}
+	};
+
+	static inline __m128i WidenLow4(__m128i bytes)
+	{
+		__m128i zero = _mm_setzero_si128();
+		return _mm_unpacklo_epi16(_mm_unpacklo_epi8(bytes, zero), zero);
+	}
+
+	static inline __m128i Load8(const uint8_t* src) { return _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)); }
+	static inline void Store8(uint8_t* dest, __m128i v) { _mm_storel_epi64(reinterpret_cast<__m128i*>(dest), v); }
+	static inline __m128i Load4(const uint32_t* src) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)); }
+	static inline void Store4(uint32_t* dest, __m128i v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), v); }
+
+	static void CompositeSSE2(uint32_t* dest, uint8_t* dest_attrs, const uint8_t* pixels, int count, const uint32_t* shades, uint8_t priority)
+	{
+		const ShadesSSE2 table(shades);
+		const __m128i prio = _mm_set1_epi8(char(priority));
+
+		int i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m128i numbers = Load8(pixels + i);
+			Store4(dest + i, table.Lookup(WidenLow4(numbers)));
+			Store4(dest + i + 4, table.Lookup(WidenLow4(_mm_srli_si128(numbers, 4))));
+			Store8(dest_attrs + i, _mm_or_si128(numbers, prio));
+		}
+
+		CompositeScalar(dest + i, dest_attrs + i, pixels + i, count - i, shades, priority);
+	}
+
+	// Returns 0xFF in each of the 8 low bytes where the sprite pixel should replace what's under it
+	static inline __m128i SpriteWriteMask(__m128i numbers, __m128i attrs, bool behind_bg, bool force)
+	{
+		const __m128i zero = _mm_setzero_si128();
+		__m128i colour_zero = _mm_cmpeq_epi8(numbers, zero);
+		__m128i under_zero = _mm_cmpeq_epi8(_mm_and_si128(attrs, _mm_set1_epi8(AttrColourNumber)), zero);
+
+		// A non-zero BG/window colour underneath blocks the sprite if that tile has priority, or always
+		// when the sprite is behind the BG
+		__m128i blocked = _mm_andnot_si128(under_zero, _mm_set1_epi8(-1));
+		if (force || !behind_bg)
+			blocked = _mm_and_si128(blocked, _mm_cmpeq_epi8(_mm_and_si128(attrs, _mm_set1_epi8(char(AttrPriority))), _mm_set1_epi8(char(AttrPriority))));
+
+		return _mm_andnot_si128(_mm_or_si128(colour_zero, blocked), _mm_set1_epi8(-1));
+	}
+
+	static inline __m128i BlendBytes(__m128i a, __m128i b, __m128i mask)
+	{
+		return _mm_or_si128(_mm_andnot_si128(mask, a), _mm_and_si128(mask, b));
+	}
+
+	static void MergeSpriteSSE2(uint32_t* dest, uint8_t* dest_attrs, const uint8_t* pixels, int count, const uint32_t* shades, bool behind_bg, bool force)
+	{
+		const ShadesSSE2 table(shades);
+
+		int i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m128i numbers = Load8(pixels + i);
+			__m128i attrs = Load8(dest_attrs + i);
+			__m128i write = SpriteWriteMask(numbers, attrs, behind_bg, force);
+
+			// Byte masks are 0 or 0xFF, so interleaving them with themselves widens them to the pixel lanes
+			__m128i write16 = _mm_unpacklo_epi8(write, write);
+			__m128i write_lo = _mm_unpacklo_epi16(write16, write16);
+			__m128i write_hi = _mm_unpackhi_epi16(write16, write16);
+
+			Store4(dest + i, BlendBytes(Load4(dest + i), table.Lookup(WidenLow4(numbers)), write_lo));
+			Store4(dest + i + 4, BlendBytes(Load4(dest + i + 4), table.Lookup(WidenLow4(_mm_srli_si128(numbers, 4))), write_hi));
+
+			__m128i new_attrs = _mm_or_si128(_mm_and_si128(attrs, _mm_set1_epi8(char(AttrPriority))), numbers);
+			Store8(dest_attrs + i, BlendBytes(attrs, new_attrs, write));
+		}
+
+		MergeSpriteScalar(dest + i, dest_attrs + i, pixels + i, count - i, shades, behind_bg, force);
+	}
+
+	// AVX2 looks the shades up with a lane permute, 8 pixels at a time
+	GEM_TARGET_AVX2 static inline __m256i LoadShadesAVX2(const uint32_t* shades)
+	{
+		return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(shades)));
+	}
+
+	GEM_TARGET_AVX2 static void CompositeAVX2(uint32_t* dest, uint8_t* dest_attrs, const uint8_t* pixels, int count, const uint32_t* shades, uint8_t priority)
+	{
+		const __m256i table = LoadShadesAVX2(shades);
+		const __m128i prio = _mm_set1_epi8(char(priority));
+
+		int i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m128i numbers = Load8(pixels + i);
+			__m256i colours = _mm256_permutevar8x32_epi32(table, _mm256_cvtepu8_epi32(numbers));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), colours);
+			Store8(dest_attrs + i, _mm_or_si128(numbers, prio));
+		}
+
+		CompositeScalar(dest + i, dest_attrs + i, pixels + i, count - i, shades, priority);
+	}
+
+	GEM_TARGET_AVX2 static void MergeSpriteAVX2(uint32_t* dest, uint8_t* dest_attrs, const uint8_t* pixels, int count, const uint32_t* shades, bool behind_bg, bool force)
+	{
+		const __m256i table = LoadShadesAVX2(shades);
+
+		int i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m128i numbers = Load8(pixels + i);
+			__m128i attrs = Load8(dest_attrs + i);
+			__m128i write = SpriteWriteMask(numbers, attrs, behind_bg, force);
+
+			__m256i* line = reinterpret_cast<__m256i*>(dest + i);
+			__m256i colours = _mm256_permutevar8x32_epi32(table, _mm256_cvtepu8_epi32(numbers));
+			_mm256_storeu_si256(line, _mm256_blendv_epi8(_mm256_loadu_si256(line), colours, _mm256_cvtepi8_epi32(write)));
+
+			__m128i new_attrs = _mm_or_si128(_mm_and_si128(attrs, _mm_set1_epi8(char(AttrPriority))), numbers);
+			Store8(dest_attrs + i, BlendBytes(attrs, new_attrs, write));
+		}
+
+		MergeSpriteScalar(dest + i, dest_attrs + i, pixels + i, count - i, shades, behind_bg, force);
+	}
+
+	static bool CPUHasAVX2()
+	{
+#ifdef _MSC_VER
+		int info[4];
+		__cpuid(info, 0);
+		if (info[0] < 7)
+			return false;
+
+		// The OS also has to save the YMM registers on a context switch
+		__cpuid(info, 1);
+		bool os_saves_avx = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && (_xgetbv(0) & 0x6) == 0x6;
+
+		__cpuidex(info, 7, 0);
+		return os_saves_avx && (info[1] & (1 << 5));
+#else
+		return __builtin_cpu_supports("avx2");
+#endif
+	}
+
+	static KernelSet Select(Level level)
+	{
+		switch (level)
+		{
+			case Level::AVX2:
+				return { Level::AVX2, CompositeAVX2, MergeSpriteAVX2 };
+			case Level::SSE2:
+				return { Level::SSE2, CompositeSSE2, MergeSpriteSSE2 };
+			default:
+				return { Level::Scalar, CompositeScalar, MergeSpriteScalar };
+		}
+	}
+
+	// SSE2 is part of x64, so it's the baseline
+	static const Level SupportedLevel = CPUHasAVX2() ? Level::AVX2 : Level::SSE2;
+	static KernelSet Active = Select(SupportedLevel);
+
+	const KernelSet& Get()
+	{
+		return Active;
+	}
+
+	Level GetSupportedLevel()
+	{
+		return SupportedLevel;
+	}
+
+	void SetLevel(Level level)
+	{
+		Active = Select(min(level, SupportedLevel));
+	}
+
+	const char* GetLevelName(Level level)
+	{
+		switch (level)
+		{
+			case Level::AVX2: return "AVX2";
+			case Level::SSE2: return "SSE2";
+			default: return "Scalar";
+		}
+	}
+}
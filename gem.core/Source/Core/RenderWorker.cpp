@@ -0,0 +1,135 @@
+#include <cstring>
+
+#include "Core/RenderWorker.h"
+#include "Core/GPU.h"
+
+using namespace std;
+
+RenderWorker::RenderWorker(const GPU& source)
+	: renderer(make_unique<GPU>())
+	, submitted(0)
+	, completed(0)
+	, shutdown(false)
+{
+	for (LineJob& job : jobs)
+		job.Writes.reserve(256);
+
+	Sync(source);
+	thread = std::thread(&RenderWorker::WorkerLoop, this);
+}
+
+RenderWorker::~RenderWorker()
+{
+	{
+		lock_guard<mutex> guard(stateLock);
+		shutdown = true;
+	}
+
+	jobSignal.notify_all();
+	thread.join();
+}
+
+void RenderWorker::SubmitLine(const GPU& source)
+{
+	LineJob& job = jobs[submitted % MaxLinesInFlight];
+	job.Control = source.control;
+	job.Positions = source.positions;
+	job.BgMonoPalette = source.bgMonoPalette;
+	job.SprMonoPalettes[0] = source.sprMonoPalettes[0];
+	job.SprMonoPalettes[1] = source.sprMonoPalettes[1];
+
+	unique_lock<mutex> guard(stateLock);
+	submitted++;
+	jobSignal.notify_one();
+
+	// Writes go straight into the next job so its slot has to be free before emulation carries on
+	doneSignal.wait(guard, [this] { return submitted - completed < MaxLinesInFlight; });
+}
+
+void RenderWorker::CopyFrame(GPU& dest)
+{
+	unique_lock<mutex> guard(stateLock);
+	WaitForIdle(guard);
+
+	memcpy(dest.frameBuffer.Ptr(), renderer->frameBuffer.Ptr(), renderer->frameBuffer.Count() * sizeof(uint32_t));
+	memcpy(dest.pixelAttributes.Ptr(), renderer->pixelAttributes.Ptr(), renderer->pixelAttributes.Count());
+}
+
+void RenderWorker::Sync(const GPU& source)
+{
+	unique_lock<mutex> guard(stateLock);
+	WaitForIdle(guard);
+
+	*renderer = source;
+	renderer->renderWorker = nullptr;
+	renderer->cart = nullptr;
+	renderer->interrupts = nullptr;
+	renderer->mmu = nullptr;
+
+	// The renderer is never ticked, this just keeps replayed OAM writes from being reported as violations
+	renderer->stat.Mode = LCDMode::HBlank;
+
+	// The source's memos hold its own version numbers and may not match its frame buffer, so every line renders once
+	for (GPU::LineMemo& memo : renderer->lineMemos)
+		memo = GPU::LineMemo();
+
+	jobs[submitted % MaxLinesInFlight].Writes.clear();
+}
+
+void RenderWorker::WaitForIdle(unique_lock<mutex>& guard)
+{
+	doneSignal.wait(guard, [this] { return completed == submitted; });
+}
+
+void RenderWorker::WorkerLoop()
+{
+	unique_lock<mutex> guard(stateLock);
+
+	while (true)
+	{
+		jobSignal.wait(guard, [this] { return shutdown || completed != submitted; });
+
+		if (shutdown)
+			return;
+
+		LineJob& job = jobs[completed % MaxLinesInFlight];
+		guard.unlock();
+
+		RenderJob(job);
+
+		guard.lock();
+		completed++;
+		doneSignal.notify_all();
+	}
+}
+
+void RenderWorker::RenderJob(LineJob& job)
+{
+	GPU& gpu = *renderer;
+
+	for (const VideoWrite& write : job.Writes)
+	{
+		switch (write.Target)
+		{
+			case WriteTarget::VRAM:
+				gpu.WriteVRAM(write.Index, write.Value);
+				break;
+			case WriteTarget::OAM:
+				gpu.WriteByteOAM(0xFE00 | write.Index, write.Value);
+				break;
+			case WriteTarget::Register:
+				gpu.WriteRegister(write.Index, write.Value);
+				break;
+		}
+	}
+
+	job.Writes.clear();
+
+	gpu.control = job.Control;
+	gpu.positions = job.Positions;
+	gpu.bgMonoPalette = job.BgMonoPalette;
+	gpu.sprMonoPalettes[0] = job.SprMonoPalettes[0];
+	gpu.sprMonoPalettes[1] = job.SprMonoPalettes[1];
+
+	(gpu.*gpu.renderLine)();
+}
@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <climits>
+
+#include "Core/SoundWorker.h"
+
+using namespace std;
+
+SoundWorker::SoundWorker(const APU& source)
+	: synth(make_unique<APU>())
+	, synthCycle(source.emulatedCycles)
+	, logged(0)
+	, applied(0)
+	, published(source.emulatedCycles)
+	, rateAdjustment(0.0f)
+	, shutdown(false)
+{
+	Sync(source);
+	thread = std::thread(&SoundWorker::WorkerLoop, this);
+}
+
+SoundWorker::~SoundWorker()
+{
+	{
+		lock_guard<mutex> guard(stateLock);
+		shutdown = true;
+	}
+
+	workSignal.notify_all();
+	thread.join();
+}
+
+void SoundWorker::LogWrite(uint64_t cycle, uint16_t addr, uint8_t value)
+{
+	uint64_t index = logged.load(memory_order_relaxed);
+
+	if (index - applied.load(memory_order_acquire) == MaxWritesInFlight)
+	{
+		// Every logged write is due by now, so the worker can always make room
+		unique_lock<mutex> guard(stateLock);
+		published = cycle;
+		workSignal.notify_one();
+		doneSignal.wait(guard, [this, index] { return index - applied.load() < MaxWritesInFlight; });
+	}
+
+	writes[index % MaxWritesInFlight] = { cycle, addr, value };
+	logged.store(index + 1, memory_order_release);
+}
+
+void SoundWorker::Publish(uint64_t cycle)
+{
+	{
+		lock_guard<mutex> guard(stateLock);
+		published = cycle;
+	}
+
+	workSignal.notify_one();
+}
+
+void SoundWorker::Finish(uint64_t cycle)
+{
+	unique_lock<mutex> guard(stateLock);
+	published = cycle;
+	workSignal.notify_one();
+	doneSignal.wait(guard, [this] { return IsIdle(); });
+}
+
+void SoundWorker::Sync(const APU& source)
+{
+	unique_lock<mutex> guard(stateLock);
+	doneSignal.wait(guard, [this] { return IsIdle(); });
+
+	*synth = source;
+	synth->soundWorker = nullptr;
+	synth->LinkEmitters();
+	snapshot = synth->snapshot;
+
+	// Carries on from the source's timeline
+	synthCycle = source.emulatedCycles;
+	published = source.emulatedCycles;
+}
+
+EmittersSnapshot SoundWorker::Snapshot()
+{
+	lock_guard<mutex> guard(stateLock);
+	return snapshot;
+}
+
+bool SoundWorker::IsIdle() const
+{
+	return synthCycle == published && applied == logged;
+}
+
+bool SoundWorker::HasWork() const
+{
+	// Writes are logged ahead of the cycle they were made on being published
+	uint64_t next = applied;
+	return synthCycle != published || (next != logged && writes[next % MaxWritesInFlight].Cycle <= published);
+}
+
+void SoundWorker::WorkerLoop()
+{
+	unique_lock<mutex> guard(stateLock);
+
+	while (true)
+	{
+		workSignal.wait(guard, [this] { return shutdown || HasWork(); });
+
+		if (shutdown)
+			return;
+
+		uint64_t target = published;
+		guard.unlock();
+
+		CatchUp(target);
+
+		guard.lock();
+		snapshot = synth->snapshot;
+		doneSignal.notify_all();
+	}
+}
+
+void SoundWorker::CatchUp(uint64_t target)
+{
+	synth->SetRateAdjustment(rateAdjustment);
+
+	uint64_t next = applied.load(memory_order_relaxed);
+	while (next != logged.load(memory_order_acquire) && writes[next % MaxWritesInFlight].Cycle <= target)
+	{
+		const SoundWrite& write = writes[next % MaxWritesInFlight];
+		TickTo(write.Cycle);
+
+		if (write.Address >= 0xFF30)
+			synth->WriteWaveRAM(write.Address, write.Value);
+		else
+			synth->WriteRegister(write.Address, write.Value);
+
+		applied.store(++next, memory_order_release);
+	}
+
+	TickTo(target);
+}
+
+void SoundWorker::TickTo(uint64_t cycle)
+{
+	while (synthCycle < cycle)
+	{
+		int span = int(min<uint64_t>(cycle - synthCycle, INT_MAX));
+		synth->TickEmitters(span);
+		synthCycle = synthCycle + span;
+	}
+}
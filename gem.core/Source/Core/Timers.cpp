@@ -99,7 +99,7 @@ void TimerController::TickTimers(int t_cycles)
 	divAcc += t_cycles;
 
 	// 64 M cycles increments Divider by 1
-	if (divAcc >= 256)
+	while (divAcc >= 256)
 	{
 		Divider++;
 		divAcc -= 256; 
@@ -56,6 +56,17 @@ void Z80::Reset(bool bCGB)
 		interrupts->Reset();
 }
 
+void Z80::ForkFrom(const Z80& parent)
+{
+	shared_ptr<MMU> own_mmu = mmu;
+	shared_ptr<InterruptController> own_interrupts = interrupts;
+
+	*this = parent;
+
+	mmu = own_mmu;
+	interrupts = own_interrupts;
+}
+
 void Z80::SetMMU(std::shared_ptr<MMU> ptr)
 {
 	mmu = ptr;
@@ -66,7 +77,10 @@ void Z80::SetMMU(std::shared_ptr<MMU> ptr)
 int Z80::Execute(uint16_t inst)
 {
 	OpCode opcode = static_cast<OpCode>(inst);
-	int m_cycles = 0;
+
+	// Timings come from the opcode table. Only the taken path of a conditional branch changes them
+	const OpCodeInfo& info = GetOpCodeInfo(inst);
+	int m_cycles = info.Cycles;
 
 #ifdef ENABLE_VERBOSE_LOGGING
 	stringstream verbose_log_message;
@@ -95,12 +109,10 @@ int Z80::Execute(uint16_t inst)
 			if (data_loc == 0x6) // 0x6 indicates to use (HL) as value
 			{
 				value = ReadByteByRegPair(H, L);
-				m_cycles = 2;
 			}
 			else
 			{
 				value = registerFile[data_loc];
-				m_cycles = 1;
 			}
 
 			registerFile[A] = AddBytes(registerFile[A], value, true); // with_carry = true
@@ -115,7 +127,6 @@ int Z80::Execute(uint16_t inst)
 
 			PC++; // increment PC to skip the immediate value
 
-			m_cycles = 2;
 			break;
 		}
 
@@ -134,12 +145,10 @@ int Z80::Execute(uint16_t inst)
 			if (data_loc == 0x6) // 0x6 indicates to use (HL) as value
 			{
 				value = ReadByteByRegPair(H, L);
-				m_cycles = 2;
 			}
 			else
 			{
 				value = registerFile[data_loc];
-				m_cycles = 1;
 			}
 
 			registerFile[A] = AddBytes(registerFile[A], value, false); // with_carry = false
@@ -154,7 +163,6 @@ int Z80::Execute(uint16_t inst)
 
 			PC++; // increment PC to skip the immediate value
 
-			m_cycles = 2;
 			break;
 		}
 
@@ -197,7 +205,6 @@ int Z80::Execute(uint16_t inst)
 			registerFile[H] = uint8_t((truncated_result & 0xFF00) >> 8);
 			registerFile[L] = uint8_t(truncated_result & 0x00FF);
 
-			m_cycles = 2;
 			break;
 		}
 
@@ -217,7 +224,6 @@ int Z80::Execute(uint16_t inst)
 			SetOperationFlag(false);
 
 			PC++;
-			m_cycles = 4;
 			break;
 		}
 
@@ -236,12 +242,10 @@ int Z80::Execute(uint16_t inst)
 			if (data_loc == 0x6) // 0x6 indicates to use (HL) as value
 			{
 				value = ReadByteByRegPair(H, L);
-				m_cycles = 2;
 			}
 			else
 			{
 				value = registerFile[data_loc];
-				m_cycles = 1;
 			}
 
 			registerFile[A] &= value;
@@ -263,7 +267,6 @@ int Z80::Execute(uint16_t inst)
 			SetCarryFlag(false);
 			PC++; // increment PC to skip the immediate value
 
-			m_cycles = 2;
 			break;
 		}
 
@@ -283,12 +286,10 @@ int Z80::Execute(uint16_t inst)
 			if (data_loc == 0x6) // 0x6 indicates to use (HL) as value
 			{
 				value = ReadByteByRegPair(H, L);
-				m_cycles = 2;
 			}
 			else
 			{
 				value = registerFile[data_loc];
-				m_cycles = 1;
 			}
 
 			registerFile[A] |= value;
@@ -310,7 +311,6 @@ int Z80::Execute(uint16_t inst)
 			SetOperationFlag(false);
 			PC++; // increment PC to skip the immediate value
 
-			m_cycles = 2;
 			break;
 		}
 
@@ -329,12 +329,10 @@ int Z80::Execute(uint16_t inst)
 			if (data_loc == 0x6) // 0x6 indicates to use (HL) as value
 			{
 				value = ReadByteByRegPair(H, L);
-				m_cycles = 2;
 			}
 			else
 			{
 				value = registerFile[data_loc];
-				m_cycles = 1;
 			}
 
 			registerFile[A] ^= value;
@@ -356,7 +354,6 @@ int Z80::Execute(uint16_t inst)
 			SetCarryFlag(false);
 			PC++; // increment PC to skip the immediate value
 
-			m_cycles = 2;
 			break;
 		}
 
@@ -431,12 +428,10 @@ int Z80::Execute(uint16_t inst)
 			{
 				uint8_t value = ReadByteByRegPair(H, L);
 				TestBit(bit_index, value);
-				m_cycles = 3;
 			}
 			else
 			{
 				TestBit(bit_index, registerFile[data_loc]);
-				m_cycles = 2;
 			}
 
 			// TestBit takes care of the zero flag
@@ -489,10 +484,9 @@ int Z80::Execute(uint16_t inst)
 				SP -= 2;
 
 				PC = (target_highorder << 8) + target_loworder;
+				m_cycles = info.BranchCycles;
 				disablePCAdvance = true;
 
-				m_cycles = 6;
-
 #ifdef ENABLE_VERBOSE_LOGGING
 				verbose_log_message << " (0x" << setw(4) << setfill('0') << PC << ") (" << dec << ++calls_on_stack << ")";
 #endif
@@ -500,7 +494,6 @@ int Z80::Execute(uint16_t inst)
 			else
 			{
 				PC += 2;
-				m_cycles = 3;
 			}
 
 			break;
@@ -511,7 +504,6 @@ int Z80::Execute(uint16_t inst)
 			SetCarryFlag(GetCarryFlag() == 0);
 			SetOperationFlag(false);
 			SetHalfCarryFlag(false);
-			m_cycles = 1;
 			break;
 		}
 
@@ -529,12 +521,10 @@ int Z80::Execute(uint16_t inst)
 			if (data_loc == 0x6) // 0x6 indicates to use (HL) as value
 			{
 				value = ReadByteByRegPair(H, L);
-				m_cycles = 2;
 			}
 			else
 			{
 				value = registerFile[data_loc];
-				m_cycles = 1;
 			}
 
 			uint8_t compared = (registerFile[A] - value) & 0xFF;
@@ -558,7 +548,6 @@ int Z80::Execute(uint16_t inst)
 
 			PC++; // increment PC to skip the immediate value
 
-			m_cycles = 2;
 			break;
 		}
 
@@ -567,7 +556,6 @@ int Z80::Execute(uint16_t inst)
 			registerFile[A] = ~registerFile[A];
 			SetOperationFlag(true);
 			SetHalfCarryFlag(true);
-			m_cycles = 1;
 			break;
 		}
 
@@ -609,7 +597,6 @@ int Z80::Execute(uint16_t inst)
 			SetHalfCarryFlag(false);
 			SetZeroFlag(registerFile[A] == 0);
 
-			m_cycles = 1;
 
 			break;
 		}
@@ -632,14 +619,12 @@ int Z80::Execute(uint16_t inst)
 				value = ReadByteByRegPair(H, L);
 				decremented = value + int8_t(-1);
 				WriteByteByRegPair(H, L, decremented);
-				m_cycles = 3;
 			}
 			else
 			{
 				value = registerFile[data_loc];
 				decremented = value + int8_t(-1);
 				registerFile[data_loc] = decremented;
-				m_cycles = 1;
 			}
 
 			SetHalfCarryFlag((value & 0xF) < 1);
@@ -680,21 +665,18 @@ int Z80::Execute(uint16_t inst)
 			}
 
 			/* these instructions have no effect on the flag register */
-			m_cycles = 2;
 			break;
 		}
 
 		case DI:
 		{
 			interruptMasterEnable = false;
-			m_cycles = 1;
 			break;
 		}
 
 		case EI:
 		{
 			interruptMasterEnable = true;
-			m_cycles = 1;
 			break;
 		}
 
@@ -702,7 +684,6 @@ int Z80::Execute(uint16_t inst)
 		{
 			// TODO: return half a cycle in double speed mode
 			isHalted = true;
-			m_cycles = 1;
 			break;
 		}
 
@@ -724,13 +705,11 @@ int Z80::Execute(uint16_t inst)
 				value = ReadByteByRegPair(H, L);
 				incremented = value + 1;
 				WriteByteByRegPair(H, L, incremented);
-				m_cycles = 3;
 			}
 			else
 			{
 				value = registerFile[data_loc];
 				incremented = ++registerFile[data_loc];
-				m_cycles = 1;
 			}
 
 			CalculateHalfCarry(value, 1, incremented);
@@ -771,7 +750,6 @@ int Z80::Execute(uint16_t inst)
 			}
 
 			/* these instructions have no effect on the flag register */
-			m_cycles = 2;
 			break;
 		}
 
@@ -804,13 +782,12 @@ int Z80::Execute(uint16_t inst)
 				uint16_t target_loworder = uint16_t(mmu->ReadByte(PC + 1));
 				uint16_t target_highorder = uint16_t(mmu->ReadByte(PC + 2));
 				PC = (target_highorder << 8) | target_loworder;
+				m_cycles = info.BranchCycles;
 				disablePCAdvance = true;
-				m_cycles = 4;
 			}
 			else
 			{
 				PC += 2; // advance the program counter to ignore these values
-				m_cycles = 3;
 			}
 
 			break;
@@ -821,7 +798,6 @@ int Z80::Execute(uint16_t inst)
 			uint16_t target_loworder = uint16_t(mmu->ReadByte(PC + 1));
 			uint16_t target_highorder = uint16_t(mmu->ReadByte(PC + 2));
 			PC = (target_highorder << 8) | target_loworder;
-			m_cycles = 4;
 			disablePCAdvance = true;
 			break;
 		}
@@ -829,7 +805,6 @@ int Z80::Execute(uint16_t inst)
 		case JPHL:
 		{
 			PC = ConcatRegisterPair(H, L);
-			m_cycles = 1;
 			disablePCAdvance = true;
 			break;
 		}
@@ -838,7 +813,6 @@ int Z80::Execute(uint16_t inst)
 		{
 			int8_t offset = int8_t(mmu->ReadByte(PC + 1));
 			PC = PC + offset + 2;
-			m_cycles = 3;
 			disablePCAdvance = true;
 			break;
 		}
@@ -871,13 +845,12 @@ int Z80::Execute(uint16_t inst)
 			{
 				int8_t offset = int8_t(mmu->ReadByte(PC + 1));
 				PC = PC + offset + 2;
+				m_cycles = info.BranchCycles;
 				disablePCAdvance = true;
-				m_cycles = 3;
 			}
 			else
 			{
 				PC++; // advance program counter to ignore immediate value
-				m_cycles = 2;
 			}
 
 			break;
@@ -912,7 +885,6 @@ int Z80::Execute(uint16_t inst)
 			}
 
 			PC += 2;
-			m_cycles = 3;
 			break;
 		}
 
@@ -927,7 +899,6 @@ int Z80::Execute(uint16_t inst)
 			uint8_t r = MaskAndShiftRight(uint8_t(inst), 0x38, 3);
 			registerFile[r] = mmu->ReadByte(PC + 1);
 			PC++;
-			m_cycles = 2;
 			break;
 		}
 
@@ -984,21 +955,18 @@ int Z80::Execute(uint16_t inst)
 			uint8_t src_reg = inst & 0x7;
 			uint8_t dest_reg = MaskAndShiftRight(uint8_t(inst), 0x38, 3);
 			registerFile[dest_reg] = registerFile[src_reg];
-			m_cycles = 1;
 			break;
 		}
 
 		case LDBC_A:
 		{
 			mmu->WriteByte(ConcatRegisterPair(B, C), registerFile[A]);
-			m_cycles = 2;
 			break;
 		}
 
 		case LDDE_A:
 		{
 			mmu->WriteByte(ConcatRegisterPair(D, E), registerFile[A]);
-			m_cycles = 2;
 			break;
 		}
 
@@ -1012,21 +980,18 @@ int Z80::Execute(uint16_t inst)
 		{
 			uint8_t r = inst & 0x7;
 			WriteByteByRegPair(H, L, registerFile[r]);
-			m_cycles = 2;
 			break;
 		}
 
 		case LDA_BC:
 		{
 			registerFile[A] = ReadByteByRegPair(B, C);
-			m_cycles = 2;
 			break;
 		}
 
 		case LDA_DE:
 		{
 			registerFile[A] = ReadByteByRegPair(D, E);
-			m_cycles = 2;
 			break;
 		}
 
@@ -1040,7 +1005,6 @@ int Z80::Execute(uint16_t inst)
 		{
 			uint8_t r = MaskAndShiftRight(uint8_t(inst), 0x38, 3);
 			registerFile[r] = ReadByteByRegPair(H, L);
-			m_cycles = 2;
 			break;
 		}
 
@@ -1049,7 +1013,6 @@ int Z80::Execute(uint16_t inst)
 			uint16_t addr = uint16_t(mmu->ReadByte(PC + 2) << 8) + uint16_t(mmu->ReadByte(PC + 1));
 			mmu->WriteByte(addr, registerFile[A]);
 			PC += 2;
-			m_cycles = 4;
 			break;
 		}
 
@@ -1058,7 +1021,6 @@ int Z80::Execute(uint16_t inst)
 			uint16_t addr = uint16_t(mmu->ReadByte(PC + 2) << 8) + uint16_t(mmu->ReadByte(PC + 1));
 			registerFile[A] = mmu->ReadByte(addr);
 			PC += 2;
-			m_cycles = 4;
 			break;
 		}
 
@@ -1067,7 +1029,6 @@ int Z80::Execute(uint16_t inst)
 			uint16_t addr = uint16_t(mmu->ReadByte(PC + 2) << 8) + uint16_t(mmu->ReadByte(PC + 1));
 			mmu->WriteWord(addr, SP);
 			PC += 2;
-			m_cycles = 5;
 			break;
 		}
 
@@ -1100,7 +1061,6 @@ int Z80::Execute(uint16_t inst)
 
 			registerFile[H] = uint8_t((concat & 0xFF00) >> 8);
 			registerFile[L] = uint8_t(concat & 0x00FF);
-			m_cycles = 2;
 			break;
 		}
 
@@ -1109,7 +1069,6 @@ int Z80::Execute(uint16_t inst)
 			uint8_t value = mmu->ReadByte(PC + 1);
 			WriteByteByRegPair(H, L, value);
 			PC++; // Ignore immediate
-			m_cycles = 3;
 			break;
 		}
 
@@ -1118,7 +1077,6 @@ int Z80::Execute(uint16_t inst)
 			uint16_t addr = 0xFF00 + mmu->ReadByte(PC + 1);
 			mmu->WriteByte(addr, registerFile[A]);
 			PC++; // Ignore immediate
-			m_cycles = 3;
 			break;
 		}
 
@@ -1126,7 +1084,6 @@ int Z80::Execute(uint16_t inst)
 		{
 			uint16_t addr = 0xFF00 + registerFile[C];
 			mmu->WriteByte(addr, registerFile[A]);
-			m_cycles = 2;
 			break;
 		}
 
@@ -1135,7 +1092,6 @@ int Z80::Execute(uint16_t inst)
 			uint16_t addr = 0xFF00 + mmu->ReadByte(PC + 1);
 			registerFile[A] = mmu->ReadByte(addr);
 			PC++; // Ignore immediate
-			m_cycles = 3;
 			break;
 		}
 
@@ -1143,7 +1099,6 @@ int Z80::Execute(uint16_t inst)
 		{
 			uint16_t addr = 0xFF00 + registerFile[C];
 			registerFile[A] = mmu->ReadByte(addr);
-			m_cycles = 2;
 			break;
 		}
 
@@ -1165,20 +1120,17 @@ int Z80::Execute(uint16_t inst)
 			registerFile[L] = uint8_t(truncated_result & 0x00FF);
 
 			PC++;
-			m_cycles = 3;
 			break;
 		}
 
 		case LDSP_HL:
 		{
 			SP = ConcatRegisterPair(H, L);
-			m_cycles = 2;
 			break;
 		}
 
 		case NOP:
 		{
-			m_cycles = 1;
 			break;
 		}
 
@@ -1216,7 +1168,6 @@ int Z80::Execute(uint16_t inst)
 #endif
 
 			SP += 2;
-			m_cycles = 3;
 
 			break;
 		}
@@ -1253,7 +1204,6 @@ int Z80::Execute(uint16_t inst)
 #endif
 
 			SP -= 2;
-			m_cycles = 4;
 
 			break;
 		}
@@ -1298,19 +1248,13 @@ int Z80::Execute(uint16_t inst)
 
 				PC = (target_high << 8) | target_low;
 				SP += 2;
-				m_cycles = 5;
+				m_cycles = info.BranchCycles;
 				disablePCAdvance = true;
 
-				if (inst == RET) m_cycles = 4;
-
 #ifdef ENABLE_VERBOSE_LOGGING
 				verbose_log_message << " (0x" << setw(4) << setfill('0') << PC << ") (" << dec << calls_on_stack-- << ")";
 #endif
 			}
-			else
-			{
-				m_cycles = 2;
-			}
 
 			break;
 		}
@@ -1325,7 +1269,6 @@ int Z80::Execute(uint16_t inst)
 			interruptMasterEnable = true;
 			disablePCAdvance = true;
 
-			m_cycles = 4;
 
 			break;
 		}
@@ -1382,7 +1325,6 @@ int Z80::Execute(uint16_t inst)
 				value = RotateByte(value, dir, carry_behavior);
 				WriteByteByRegPair(H, L, value);
 				SetZeroFlag(value == 0);
-				m_cycles = 4;
 			}
 			else
 			{
@@ -1390,12 +1332,10 @@ int Z80::Execute(uint16_t inst)
 
 				if (inst == RLC_A_2B || inst == RRC_A || inst == RLA_2B || inst == RRA_2B)
 				{
-					m_cycles = 1;
 					SetZeroFlag(false);
 				}
 				else
 				{
-					m_cycles = 2;
 					SetZeroFlag(registerFile[data_loc] == 0);
 				}
 			}
@@ -1445,14 +1385,12 @@ int Z80::Execute(uint16_t inst)
 				WriteByteByRegPair(H, L, value);
 
 				SetZeroFlag(value == 0);
-				m_cycles = 4;
 			}
 			else
 			{
 				ShiftRegister(data_loc, dir, shift_type);
 
 				SetZeroFlag(registerFile[data_loc] == 0);
-				m_cycles = 2;
 			}
 
 			SetHalfCarryFlag(false);
@@ -1465,7 +1403,6 @@ int Z80::Execute(uint16_t inst)
 			SetCarryFlag(true);
 			SetOperationFlag(false);
 			SetHalfCarryFlag(false);
-			m_cycles = 1;
 			break;
 		}
 
@@ -1476,7 +1413,6 @@ int Z80::Execute(uint16_t inst)
 			else
 				isStopped = true;
 
-			m_cycles = 1;
 			break;
 		}
 
@@ -1497,7 +1433,6 @@ int Z80::Execute(uint16_t inst)
 			PC = p * 0x8;
 
 			disablePCAdvance = true;
-			m_cycles = 4;
 			break;
 		}
 
@@ -1516,12 +1451,10 @@ int Z80::Execute(uint16_t inst)
 			if (data_loc == 0x6) // 0x6 indicates to use (HL) as value
 			{
 				value = ReadByteByRegPair(H, L);
-				m_cycles = 2;
 			}
 			else
 			{
 				value = registerFile[data_loc];
-				m_cycles = 1;
 			}
 
 			uint8_t carryin = GetCarryFlag();
@@ -1550,7 +1483,6 @@ int Z80::Execute(uint16_t inst)
 			registerFile[A] = dirty & 0xFF;
 			SetZeroFlag(registerFile[A] == 0);
 
-			m_cycles = 2;
 			PC++;
 
 			break;
@@ -1571,12 +1503,10 @@ int Z80::Execute(uint16_t inst)
 			if (data_loc == 0x6) // 0x6 indicates to use (HL) as value
 			{
 				value = ReadByteByRegPair(H, L);
-				m_cycles = 2;
 			}
 			else
 			{
 				value = registerFile[data_loc];
-				m_cycles = 1;
 			}
 
 			int32_t dirty = registerFile[A] - value;
@@ -1604,7 +1534,6 @@ int Z80::Execute(uint16_t inst)
 			registerFile[A] = dirty & 0xFF;
 
 			PC++;
-			m_cycles = 2;
 
 			break;
 		}
@@ -1625,14 +1554,12 @@ int Z80::Execute(uint16_t inst)
 				uint8_t result = (value & 0x0F) << 4 | (value & 0xF0) >> 4;
 				WriteByteByRegPair(H, L, result);
 				SetZeroFlag(result == 0);
-				m_cycles = 4;
 			}
 			else
 			{
 				uint8_t value = registerFile[data_loc];
 				registerFile[data_loc] = (value & 0x0F) << 4 | (value & 0xF0) >> 4;
 				SetZeroFlag(registerFile[data_loc] == 0);
-				m_cycles = 2; // TODO: these are guesses
 			}
 			
 			SetOperationFlag(false);
@@ -1713,12 +1640,10 @@ int Z80::Execute(uint16_t inst)
 			{
 				uint8_t value = ReadByteByRegPair(H, L);
 				WriteByteByRegPair(H, L, ClearBit(b, value));
-				m_cycles = 4;
 			}
 			else
 			{
 				ClearRegisterBit(b, data_loc);
-				m_cycles = 2;
 			}
 
 			break;
@@ -1796,12 +1721,10 @@ int Z80::Execute(uint16_t inst)
 			{
 				uint8_t value = ReadByteByRegPair(H, L);
 				WriteByteByRegPair(H, L, SetBit(b, value));
-				m_cycles = 4;
 			}
 			else
 			{
 				SetRegisterBit(b, data_loc);
-				m_cycles = 2;
 			}
 
 			break;
@@ -1,6 +1,7 @@
 
 #include <list>
 #include <cassert>
+#include <algorithm>
 
 #include "Disassembler.h"
 #include "Core/Instruction.h"
@@ -30,8 +31,8 @@ string StringLower(string str)
 
 string DisassemblyEntry::GetMnemonic() const
 {
-	OpCodeInfo op;
-	if (OpCodeIndex::Get().Lookup(OpCode, op))
+	const OpCodeInfo& op = GetOpCodeInfo(OpCode);
+	if (op.IsValid())
 	{
 		string mnemonic = op.Mnemonic;
 		char imm_str[5];
@@ -84,22 +85,20 @@ Disassembler::Disassembler()
 // Is addr an opcode or is it an immediate value?
 bool IsImmediateValue(uint16_t addr, MMU& memory)
 {
-	auto& index = OpCodeIndex::Get();
-
 	uint16_t b2 = memory.ReadByte(addr - 2);
-	if (index.Contains(b2) && index.GetImmSize(b2) == 2)
+	if (IsValidOpCode(b2) && GetInstructionImmSize(b2) == 2)
 	{
 		return true;
 	}
 
 	uint16_t b1 = memory.ReadByte(addr - 1);
-	if (index.Contains(b1) && index.GetImmSize(b1) == 1)
+	if (IsValidOpCode(b1) && GetInstructionImmSize(b1) == 1)
 	{
 		return true;
 	}
 
 	uint16_t b0 = memory.ReadByte(addr);
-	return index.Contains(b0);
+	return IsValidOpCode(b0);
 }
 
 bool IsBetween(int x, int a, int b)
@@ -161,7 +160,7 @@ bool Disassembler::FindAnchor(uint16_t start_addr, MMU& memory, int max_look_beh
 		if (prev_addr == 0)
 			prev_addr = curr_addr;
 
-		if (!OpCodeIndex::Get().Contains(b) && b != 0xCB)
+		if (!IsValidOpCode(b) && b != 0xCB)
 		{
 			anchor = curr_addr + 1;
 			break;
@@ -248,9 +247,9 @@ void Disassembler::Decode(uint16_t addr, int count, bool look_behind_for_anchor,
 			opcode = b0;
 		}
 
-		assert(OpCodeIndex::Get().Contains(opcode));
+		assert(IsValidOpCode(opcode));
 
-		int imm = OpCodeIndex::Get().GetImmSize(opcode);
+		int imm = GetInstructionImmSize(opcode);
 		if (imm == 0)
 		{
 			out_chunk_ptr->Entries.push_back(DisassemblyEntry(static_cast<OpCode>(opcode), addr));
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <memory>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+class APU;
+class GemSoundStream;
+
+// Counted over the frames paced by the audio ring since the last ResetStats()
+struct PacerStats
+{
+	uint32_t Frames = 0;
+	uint32_t Waits = 0; // Frames that had to wait for the device to drain the ring
+	uint32_t Sleeps = 0;
+	float WaitTime = 0; // ms
+	uint32_t Late = 0; // Frames that found the ring already drained past the wait threshold, the loop is falling behind
+	uint32_t Timeouts = 0; // Waits given up on because the device stopped draining
+};
+
+// Paces the main loop, one call per emulated frame. While sound is playing the audio ring is the master
+// clock: the loop waits until the device has drained the ring far enough that the next frame's samples
+// bring it back to the target fill. The APU's resampling ratio is nudged by up to MaxRateAdjustment to keep
+// the fill centred when something else (e.g. presenting with vsync) holds the loop to a slightly different
+// rate. Without sound the loop sleeps until the next frame is due, unless vsync is already pacing it.
+class FramePacer
+{
+	public:
+		FramePacer();
+		void Init(GemSoundStream* sound_ptr, std::shared_ptr<APU> apu_ptr, bool use_vsync);
+		void EndFrame(bool audio_produced);
+		void Reset();
+
+		float RateAdjustment() const { return rateAdjustment; }
+		const PacerStats& Stats() const { return stats; }
+		std::string GetStatsSummary() const;
+		void ResetStats() { stats = PacerStats(); }
+
+		static constexpr float FrameDuration = 70224 * 1000.0f / 4194304; // ms per frame at the DMG clock rate
+		static constexpr float TargetLatency = 50.0f; // ms of audio to keep queued
+		static constexpr float MaxRateAdjustment = 0.005f;
+		static const int MaxFrameLag = 8;
+
+	private:
+		static constexpr float RateGain = 0.02f; // Rate adjustment per unit of (smoothed) fill error
+		static constexpr float ErrorSmoothing = 0.05f;
+
+		void WaitForAudio();
+		void WaitForClock();
+
+		GemSoundStream* sound;
+		std::shared_ptr<APU> apu;
+		bool vsync;
+
+		float fillError;
+		float rateAdjustment;
+		PacerStats stats;
+		std::chrono::steady_clock::time_point nextFrameTime;
+};
@@ -2,11 +2,14 @@
 
 #include <vector>
 #include <string>
+#include <chrono>
 
 #include "DArray.h"
+#include "AudioCapture.h"
 #include "Core/Gem.h"
 #include "RenderWindow.h"
 #include "GemSoundStream.h"
+#include "FramePacer.h"
 #include "MsgPad.h"
 #include "GemDebugger.h"
 #include "GemConsole.h"
@@ -23,6 +26,7 @@ class GemApp
 		bool InitCore();
 		void Shutdown();
 		void WindowLoop();
+		void RenderAudio(); // Runs through GemConfig::RenderSeconds of emulation unthrottled, for capturing sound
 		const Gem& GetCore() const { return core; }
 
 	private:
@@ -32,6 +36,8 @@ class GemApp
 		bool ShouldEmulateCGBMode();
 		
 		GemSoundStream sound;
+		FramePacer pacer;
+		AudioCapture capture;
 
 		Gem core;
 
@@ -48,10 +54,16 @@ class GemApp
 		bool LoopWork();
 		bool DebuggerTick(bool emu_paused);
 
+		// While the loop is running behind the emulated frame rate, frames are still emulated but only some are drawn
+		std::chrono::steady_clock::time_point lastFrameTime;
+		float frameLag;
+		void UpdateFrameSkip();
+		void ResetFrameSkip();
+
 		RenderWindow* mainWindow;
 		GemDebugger debugger;
 
-		ColourBuffer rewindFrame;
+		PixelBuffer rewindFrame;
 		RewindManager rewind;
 		bool recordRewindBuffer;
 };
\ No newline at end of file
@@ -2,6 +2,7 @@
 #pragma once
 
 #include <fstream>
+#include <string>
 
 #include "Colour.h"
 
@@ -22,6 +23,10 @@ struct GemConfig
 	bool NoSound;
 	bool ForceDMGMode;
 	bool PauseAfterOpen;
+	std::string CaptureAudioPath; // WAV file the sound is streamed to, empty for none
+	bool CaptureStems; // Also write a file for each channel next to it
+	int GBSSong; // 1 based song to play from a .gbs file, 0 for the one its header starts with
+	float RenderSeconds; // Render this much sound as fast as possible and exit instead of opening the window
 
 	// Keyboard mapping
 	int UpKey;
@@ -45,5 +50,10 @@ struct GemConfig
 	int RewindUndoKey;
 	bool RewindClearBufferOnStop;
 
+	int MaxFrameSkip; // Most frames in a row left undrawn while emulation is behind, 0 to always draw
+	bool PipelinedRendering; // Draw lines on a worker thread
+	bool AccurateMode3; // Variable mode 3 length and mid-line register writes
+	bool ThreadedAudio; // Synthesise sound on a worker thread from a log of register writes
+
 	static GemConfig& Get();
 };
\ No newline at end of file
@@ -35,6 +35,7 @@ enum class CommandType
     APUChannelOn,
     APUChannelMask,
     RewindStats,
+    AudioStats,
     Reset,
     Exit
 };
@@ -10,6 +10,9 @@
 #include "GemConsole.h"
 #include "OpenGL/PixelUploader.h"
 
+class GemSoundStream;
+class FramePacer;
+
 struct UIEditingModel
 {
 	UIEditingModel(){}
@@ -85,6 +88,7 @@ public:
 	void MemDump(uint16_t start, int count);
 
 	void SetCore(Gem* ptr);
+	void SetAudio(GemSoundStream* sound_ptr, FramePacer* pacer_ptr);
 	bool IsInitialized() const { return initialized; }
 	bool IsHidden() const { return hidden; }
 
@@ -102,6 +106,7 @@ private:
 	void LayoutWidgets();
 	void LayoutGPUVisuals();
 	void LayoutAudioVisuals();
+	void LayoutAudioStats();
 	void UpdateDisassembly(uint16_t addr);
 	void GenerateDisassemblyText(const DisassemblyChunk& chunk, std::vector<std::string>& out_text);
 	bool CaptureScreenshot(std::string filename);
@@ -110,6 +115,8 @@ private:
 	bool RemoveBreakpoint(uint16_t address, BreakpointType type = BreakpointType::None, bool unmark_dasm = false);
 
 	Gem* core;
+	GemSoundStream* sound;
+	FramePacer* pacer;
 	UIEditingModel model;
 
 	const int WND_WIDTH = 700;
@@ -134,15 +141,15 @@ private:
 	DisassemblyChunk* currentDisassemblyChunk;
 
 	SpriteData spriteInfos[GPU::NumSprites];
-	ColourBuffer spriteBuffers[GPU::NumSprites];
+	PixelBuffer spriteBuffers[GPU::NumSprites];
 	PixelUploader spritePxUploaders[GPU::NumSprites];
 
 	CGBTileAttribute tileAttrs[GPU::NumTilesPerSet];
-	ColourBuffer tileBuffers[GPU::NumTilesPerSet];
+	PixelBuffer tileBuffers[GPU::NumTilesPerSet];
 	PixelUploader tilePxUploaders[GPU::NumTilesPerSet];
 	uint16_t tileNumbers[GPU::NumTilesPerSet];
 
 	ColourPalette::PaletteEntry paletteEntries[GPU::NumPaletteColours];
-	ColourBuffer paletteBuffers[GPU::NumPaletteColours];
+	PixelBuffer paletteBuffers[GPU::NumPaletteColours];
 	PixelUploader palettePxUploaders[GPU::NumPaletteColours];
 };
\ No newline at end of file
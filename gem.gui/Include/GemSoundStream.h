@@ -1,32 +1,47 @@
-
 #pragma once
 
 #include <memory>
+#include <string>
 
 #define SDL_MAIN_HANDLED
 #include <SDL.h>
 
-#include "DArray.h"
-#include "IAudioQueue.h"
+#include "AudioRing.h"
 
 class APU;
 
-class GemSoundStream : public IAudioQueue
+// Plays the APU's output through an SDL callback that pulls from a lock-free ring the APU writes into
+class GemSoundStream
 {
 public:
 	GemSoundStream();
 	bool Init(std::shared_ptr<APU> ptr);
 	void Play();
 	void Pause();
-	virtual int GetQueuedSampleCount() override;
-	virtual void PushAudioData(const DArray<float>& buffer) override;
+	int GetQueuedFrameCount() const;
+	uint32_t Underruns() const { return ring ? ring->Underruns() : 0; }
+	uint32_t Overruns() const { return ring ? ring->Overruns() : 0; }
+	const AudioRing* Ring() const { return ring.get(); }
+	int SampleRate() const { return sampleRate; }
+	float LatencyEstimate() const; // ms from the APU writing a frame to the device playing it: the ring's fill plus the device's own buffer
+	std::string GetStatsSummary() const;
+	void ResetStats();
 	void ClearQueue();
 	void Shutdown();
 	const bool IsInitialized() const { return initialized; }
 	const bool IsRewinding() const { return playing; }
+	const bool IsPlaying() const { return playing; }
+
+	static const int CallbackFrameCount = 1024;
+
 private:
+	static void SDLCALL AudioCallback(void* userdata, Uint8* stream, int len);
+
 	SDL_AudioDeviceID device;
+	int sampleRate;
+	int deviceFrames;
 	std::shared_ptr<APU> apu;
+	std::unique_ptr<AudioRing> ring;
 	bool initialized;
 	bool playing;
 };
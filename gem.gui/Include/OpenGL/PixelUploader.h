@@ -3,23 +3,23 @@
 
 #include "IDrawTarget.h"
 
-struct ColourBuffer;
+struct PixelBuffer;
 
 class PixelUploader
 {
 public:
 	PixelUploader();
-	bool Init(const ColourBuffer* buffer);
+	bool Init(const PixelBuffer* buffer);
 	void Upload();
 
-	ColourBuffer* BufferPtr() const { return clientBuffer; }
+	PixelBuffer* BufferPtr() const { return clientBuffer; }
 	bool IsInitialized() const { return clientBuffer != nullptr; }
 
 	int TextureId() const { return texId; }
 
 private:
 	unsigned int texId;
-	ColourBuffer* clientBuffer;
+	PixelBuffer* clientBuffer;
 	unsigned int pboIds[2];
 	bool buffersCreated;
 	int index;
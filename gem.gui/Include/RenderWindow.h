@@ -12,7 +12,7 @@
 
 #include "IDrawTarget.h"
 #include "FontGlyphCache.h"
-#include "IAudioQueue.h"
+#include "GemSoundStream.h"
 #include "Logging.h"
 #include "Core/GPURegisters.h"
 #include "Core/Joypad.h"
@@ -54,16 +54,14 @@ struct _StaticFontLoader
 class RenderWindow : public IDrawTarget
 {
 	public:
-		RenderWindow(const char* title, int buff_width, int buff_height, IAudioQueue* queue, bool vsync, float scale = 1);
+		RenderWindow(const char* title, int buff_width, int buff_height, GemSoundStream* sound, bool vsync, float scale = 1);
 		~RenderWindow();
-		virtual void DrawFrame(const ColourBuffer& new_frame) override;
+		virtual void DrawFrame(const PixelBuffer& new_frame) override;
 		virtual void DrawRect(int w, int h, int x, int y, const GemColour& colour) override;
 		virtual void DrawString(const char* cstr, const GemColour& color, int size, int x, int y) override;
 		virtual void Fill(const GemColour& colour) override;
 		void DrawString(const char* cstr, const SDL_Color& color, TTF_Font* font, int size, int x, int y);
 		void Present();
-		int GetFrameRateLimit() const { return frLimit; }
-		void SetFrameRateLimit(unsigned int limit);
 		void ZeroBuffer();
 		void SetTitle(const char* title);
 
@@ -76,7 +74,6 @@ class RenderWindow : public IDrawTarget
 
 		void ShowFPSCounter(bool enable) { showFPS = enable; }
 
-		static const int DefaultFrameRate = 60;
 		static const int FontSize = 14;
 
 	private:
@@ -116,10 +113,7 @@ class RenderWindow : public IDrawTarget
 		
 		uint8_t* frameBuffer;
 		bool vsync;
-		int frLimit;
-		float simFrameTime;
 		float avgFrameTime;
-		int fpsDelay;
 		int adjustmentCtr;
 		std::chrono::steady_clock::time_point lastTime;
 };
\ No newline at end of file
@@ -148,7 +148,7 @@ public:
 
 	bool StartRewind();
 	void ApplyCurrentRewindSnapshot();
-	void GetCurrentRewindFrame(ColourBuffer& framebuffer);
+	void GetCurrentRewindFrame(PixelBuffer& framebuffer);
 	bool StopRewind(bool continueFromStart);
 	bool IsRewinding() const { return isRewinding; }
 
@@ -164,8 +164,8 @@ private:
 	bool CompressData(const uint8_t* data, int len, std::vector<uint8_t>& output_buffer);
 	bool DecompressData(const uint8_t* data, int len, std::vector<uint8_t>& output_buffer);
 
-	bool EncodeVideoFrame(const ColourBuffer& framebuffer, AVPacket*& output_packet);
-	bool DecodeVideoFrame(const AVPacket* packet, ColourBuffer& output_buffer);
+	bool EncodeVideoFrame(const PixelBuffer& framebuffer, AVPacket*& output_packet);
+	bool DecodeVideoFrame(const AVPacket* packet, PixelBuffer& output_buffer);
 
 	bool initialized = false;
 	bool shutdown = false;
@@ -198,4 +198,5 @@ private:
 	AVCodecContext* vidEncoder = nullptr;
 	AVCodecContext* vidDecoder = nullptr;
 	AVFrame* vidFrame = nullptr;
+	long vidFrameTimestamp = 0;
 };
\ No newline at end of file
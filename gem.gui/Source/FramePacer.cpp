@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <thread>
+#include <sstream>
+#include <iomanip>
+
+#include "Core/APU.h"
+#include "GemSoundStream.h"
+#include "FramePacer.h"
+
+using namespace std;
+using namespace std::chrono;
+
+FramePacer::FramePacer()
+	: sound(nullptr)
+	, vsync(false)
+	, fillError(0)
+	, rateAdjustment(0)
+{
+}
+
+void FramePacer::Init(GemSoundStream* sound_ptr, shared_ptr<APU> apu_ptr, bool use_vsync)
+{
+	sound = sound_ptr;
+	apu = apu_ptr;
+	vsync = use_vsync;
+	Reset();
+}
+
+void FramePacer::Reset()
+{
+	fillError = 0;
+	nextFrameTime = steady_clock::time_point();
+}
+
+void FramePacer::EndFrame(bool audio_produced)
+{
+	// Rewinding and the debugger don't feed the ring, so there's nothing to follow but the clock
+	if (audio_produced && sound && sound->IsInitialized() && sound->IsPlaying())
+	{
+		WaitForAudio();
+		nextFrameTime = steady_clock::time_point();
+	}
+	else
+	{
+		WaitForClock();
+	}
+}
+
+void FramePacer::WaitForAudio()
+{
+	int rate = apu->SampleRate();
+	int target = int(TargetLatency * rate / 1000);
+	int frame_samples = int(FrameDuration * rate / 1000);
+
+	// The frame just emulated should have brought the fill up to the target. If it's off, produce
+	// slightly more or fewer samples per frame until it settles back.
+	int queued = sound->GetQueuedFrameCount();
+	float error = float(queued - target) / target;
+	fillError += (error - fillError) * ErrorSmoothing;
+	rateAdjustment = clamp(-fillError * RateGain, -MaxRateAdjustment, MaxRateAdjustment);
+	apu->SetRateAdjustment(rateAdjustment);
+
+	// Then wait for the device to make room for the next one. The wait is capped in case the device stalls.
+	int threshold = target - frame_samples;
+	steady_clock::time_point start = steady_clock::now();
+	steady_clock::time_point give_up = start + duration_cast<steady_clock::duration>(duration<float, milli>(FrameDuration * 2));
+
+	stats.Frames++;
+	if (queued > threshold)
+		stats.Waits++;
+	else
+		stats.Late++;
+
+	while (queued > threshold)
+	{
+		if (steady_clock::now() >= give_up)
+		{
+			stats.Timeouts++;
+			break;
+		}
+
+		float ms = float(queued - threshold) * 1000 / rate;
+		if (ms > 1.5f)
+		{
+			this_thread::sleep_for(duration<float, milli>(ms - 1.0f));
+			stats.Sleeps++;
+		}
+		else
+		{
+			this_thread::yield();
+		}
+
+		queued = sound->GetQueuedFrameCount();
+	}
+
+	stats.WaitTime += duration<float, milli>(steady_clock::now() - start).count();
+}
+
+string FramePacer::GetStatsSummary() const
+{
+	stringstream ss;
+	ss << fixed << setprecision(1);
+
+	ss << "Frames paced by audio: " << stats.Frames << endl;
+	ss << "Waited for the device: " << stats.Waits << " frames, " << stats.Sleeps << " sleeps, "
+		<< (stats.Frames > 0 ? stats.WaitTime / stats.Frames : 0.0f) << " ms per frame" << endl;
+	ss << "Arrived late:          " << stats.Late << endl;
+	ss << "Waits timed out:       " << stats.Timeouts << endl;
+	ss << "Rate adjustment:       " << setprecision(2) << rateAdjustment * 100 << "%" << endl;
+
+	return ss.str();
+}
+
+void FramePacer::WaitForClock()
+{
+	if (vsync)
+		return;
+
+	steady_clock::time_point now = steady_clock::now();
+	duration<float, milli> frame(FrameDuration);
+
+	// Start over after a pause or if the loop has fallen too far behind to catch up
+	if (nextFrameTime.time_since_epoch().count() == 0 || now - nextFrameTime > frame * MaxFrameLag)
+		nextFrameTime = now;
+
+	nextFrameTime += duration_cast<steady_clock::duration>(frame);
+	this_thread::sleep_until(nextFrameTime);
+}
@@ -1,5 +1,6 @@
 
 #include <chrono>
+#include <algorithm>
 #include <filesystem>
 #include <cmath>
 #include <sstream>
@@ -11,6 +12,8 @@
 #include "GemConfig.h"
 #include "Logging.h"
 #include "RewindManager.h"
+#include "Core/GBSFile.h"
+#include "Core/GemConstants.h"
 
 using namespace std;
 using namespace std::chrono;
@@ -25,6 +28,7 @@ GemApp::GemApp()
 	, core()
 	, recordRewindBuffer(false)
 	, rewindFrame(GPU::LCDWidth, GPU::LCDHeight)
+	, frameLag(0)
 {
 }
 
@@ -87,6 +91,22 @@ bool GemApp::Init(vector<string> args)
 		{
 			config.PauseAfterOpen = true;
 		}
+		else if (StringStartsWith(arg, "--capture-audio="))
+		{
+			config.CaptureAudioPath = arg.substr(arg.find_first_of('=') + 1);
+		}
+		else if (StringEquals(arg, "--capture-stems"))
+		{
+			config.CaptureStems = true;
+		}
+		else if (StringStartsWith(arg, "--gbs-song="))
+		{
+			config.GBSSong = stoi(arg.substr(arg.find_first_of('=') + 1));
+		}
+		else if (StringStartsWith(arg, "--render-seconds="))
+		{
+			config.RenderSeconds = stof(arg.substr(arg.find_first_of('=') + 1));
+		}
 		else if (StringStartsWith(arg, "--res-scale="))
 		{
 			size_t pos = arg.find_first_of('=');
@@ -100,6 +120,10 @@ bool GemApp::Init(vector<string> args)
 
 	config.Save();
 
+	// Rendering runs unthrottled so there's nothing to play the samples in step with
+	if (config.RenderSeconds > 0)
+		config.NoSound = true;
+
 	LOG_INFO("[GEM] Operating in %s mode", (GemConfig::Get().ForceDMGMode ? "DMG" : "CGB"));
 	
 	if (SDL_Init(SDL_INIT_VIDEO) != 0)
@@ -117,9 +141,14 @@ bool GemApp::Init(vector<string> args)
 	if (config.ShowDebugger)
 	{
 		if (debugger.Init())
+		{
 			debugger.SetCore(&core);
+			debugger.SetAudio(&sound, &pacer);
+		}
 		else
+		{
 			LOG_WARN("Debugger could not be initialized: %s", SDL_GetError());
+		}
 	}
 
 	if (!InitCore())
@@ -147,6 +176,18 @@ bool GemApp::Init(vector<string> args)
 
 bool GemApp::InitCore()
 {
+	GemConfig& config = GemConfig::Get();
+	GemPalette dmg_palette = core.GetGPU()->GetDMGPalette();
+	dmg_palette.ReAssign(0, config.Colour0);
+	dmg_palette.ReAssign(1, config.Colour1);
+	dmg_palette.ReAssign(2, config.Colour2);
+	dmg_palette.ReAssign(3, config.Colour3);
+	core.GetGPU()->SetDMGPalette(dmg_palette);
+
+	core.GetGPU()->SetPipelined(config.PipelinedRendering);
+	core.GetGPU()->SetAccurateMode3(config.AccurateMode3);
+	core.GetAPU()->SetThreaded(config.ThreadedAudio);
+
 	if (!GemConfig::Get().NoSound)
 	{
 		if (!sound.IsInitialized() && !sound.Init(core.GetAPU()))
@@ -159,12 +200,36 @@ bool GemApp::InitCore()
 	{
 		core.ToggleSound(false);
 	}
+
+	if (!config.CaptureAudioPath.empty() && !capture.IsCapturing())
+	{
+		if (capture.Start(config.CaptureAudioPath, core.GetAPU()->SampleRate(), config.CaptureStems))
+			core.GetAPU()->SetCapture(&capture);
+	}
+
+	// The capture still needs the samples when nothing is playing them
+	if (capture.IsCapturing())
+		core.ToggleSound(true);
+
+	pacer.Init(&sound, core.GetAPU(), config.VSync);
 	
 	if (!GMsgPad.ROMPath.empty())
 	{
+		bool is_gbs = StringEndsWith(StringLower(GMsgPad.ROMPath), ".gbs");
+		GBSFile gbs;
+
 		try
 		{
-			core.LoadRom(GMsgPad.ROMPath.c_str());
+			if (is_gbs)
+			{
+				gbs.LoadFile(GMsgPad.ROMPath.c_str());
+				int song = config.GBSSong > 0 ? config.GBSSong : gbs.Header().FirstSong;
+				core.LoadRom(gbs.BuildImage(song - 1));
+			}
+			else
+			{
+				core.LoadRom(GMsgPad.ROMPath.c_str());
+			}
 		}
 		catch (exception& ex)
 		{
@@ -172,17 +237,32 @@ bool GemApp::InitCore()
 			return false;
 		}
 
+		// A sound rip has nothing to show so the PPU is left out
+		core.SetAudioOnly(is_gbs);
 		core.Reset(ShouldEmulateCGBMode());
 
 		shared_ptr<CartridgeReader> rom_reader = core.GetCartridgeReader();
 
-		GemConsole::Get().PrintLn("ROM file loaded");
-		GemConsole::Get().PrintLn("Title: %s", rom_reader->Properties().Title);
-		GemConsole::Get().PrintLn("ROM Size: %d KB", rom_reader->Properties().ROMSize);
-		GemConsole::Get().PrintLn("RAM Size: %d KB", rom_reader->Properties().RAMSize);
-		GemConsole::Get().PrintLn("Cartridge: %s", CartridgeReader::ROMTypeString(rom_reader->Properties().Type).c_str());
-		GemConsole::Get().PrintLn("CGB: %s", CartridgeReader::CGBSupportString(rom_reader->Properties().CGBCompatability).c_str());
-		GemConsole::Get().PrintLn("");
+		if (is_gbs)
+		{
+			const GBSHeader& header = gbs.Header();
+			GemConsole::Get().PrintLn("GBS file loaded");
+			GemConsole::Get().PrintLn("Title: %s", header.Title.c_str());
+			GemConsole::Get().PrintLn("Author: %s", header.Author.c_str());
+			GemConsole::Get().PrintLn("Copyright: %s", header.Copyright.c_str());
+			GemConsole::Get().PrintLn("Song: %d of %d", config.GBSSong > 0 ? config.GBSSong : header.FirstSong, header.SongCount);
+			GemConsole::Get().PrintLn("");
+		}
+		else
+		{
+			GemConsole::Get().PrintLn("ROM file loaded");
+			GemConsole::Get().PrintLn("Title: %s", rom_reader->Properties().Title);
+			GemConsole::Get().PrintLn("ROM Size: %d KB", rom_reader->Properties().ROMSize);
+			GemConsole::Get().PrintLn("RAM Size: %d KB", rom_reader->Properties().RAMSize);
+			GemConsole::Get().PrintLn("Cartridge: %s", CartridgeReader::ROMTypeString(rom_reader->Properties().Type).c_str());
+			GemConsole::Get().PrintLn("CGB: %s", CartridgeReader::CGBSupportString(rom_reader->Properties().CGBCompatability).c_str());
+			GemConsole::Get().PrintLn("");
+		}
 	}
 	else if (core.IsROMLoaded())
 	{
@@ -208,6 +288,9 @@ void GemApp::Shutdown()
 {
 	GemConfig::Get().Save();
 
+	core.GetAPU()->SetCapture(nullptr);
+	capture.Stop();
+
 	if (!GemConfig::Get().NoSound)
 		sound.Shutdown();
 	
@@ -264,10 +347,19 @@ bool GemApp::LoadGemSave()
 	int size;
 	READ(&size, sizeof(int));
 
-	assert(size == sizeof(GemColour) * GPU::LCDWidth * GPU::LCDHeight);
 	assert(core.GetGPU()->GetFrameBuffer().IsAllocated());
 
 	const auto& fb = core.GetGPU()->GetFrameBuffer();
+	if (size != int(fb.Size()))
+	{
+		// Saves from before the frame buffer was packed hold a different pixel layout. The
+		// frame is only for display until the next one is rendered so it's safe to skip.
+		LOG_WARN("Skipping frame buffer of unexpected size (%d bytes)", size);
+		fin.seekg(size, ios::cur);
+		LOG_INFO("Gem save loaded (%d bytes)", count);
+		return true;
+	}
+
 	void* dest_ptr = (void*)fb.Ptr();
 	prev = count;
 	READ(dest_ptr, fb.Size());
@@ -320,7 +412,7 @@ bool GemApp::WriteGemSave()
 	
 	assert(fb.IsAllocated());
 	prev = count;
-	GemColour* ptr = const_cast<GemColour*>(fb.Ptr());
+	uint32_t* ptr = const_cast<uint32_t*>(fb.Ptr());
 	WRITE(ptr, size);
 	if ((count - prev) < size)
 	{
@@ -358,6 +450,32 @@ bool GemApp::ShouldEmulateCGBMode()
 				|| compat == CGBSupport::CGBOnly;
 }
 
+void GemApp::RenderAudio()
+{
+	if (!core.IsROMLoaded())
+	{
+		LOG_ERROR("Nothing to render, no ROM or GBS file was given");
+		return;
+	}
+
+	if (!capture.IsCapturing())
+		LOG_WARN("Rendering without --capture-audio, the sound won't go anywhere");
+
+	GemConfig& config = GemConfig::Get();
+	long frames = lround(config.RenderSeconds * GemConstants::TClockSpeed / GemConstants::TCyclesPerFrame);
+
+	LOG_INFO("Rendering %.1f seconds of sound (%ld frames)", config.RenderSeconds, frames);
+	auto start = chrono::steady_clock::now();
+
+	for (long i = 0; i < frames; i++)
+		core.TickUntilVBlank();
+
+	core.GetAPU()->Flush();
+
+	float elapsed = chrono::duration<float>(chrono::steady_clock::now() - start).count();
+	LOG_INFO("Rendered in %.2f seconds (%.0fx realtime)", elapsed, config.RenderSeconds / max(elapsed, 0.001f));
+}
+
 void GemApp::WindowLoop()
 {
 	mainWindow = new RenderWindow("", GPU::LCDWidth, GPU::LCDHeight, &sound, GemConfig::Get().VSync, GemConfig::Get().ResolutionScale);
@@ -455,23 +573,37 @@ bool GemApp::LoopWork()
 		{
 			// Restore the recorded state of the core
 			rewind.ApplyCurrentRewindSnapshot();
+			ResetFrameSkip();
+			pacer.EndFrame(false);
 			present = true;
 		}
 		else if (!debugger.AnyBreakpoints())
 		{
 			core.TickUntilVBlank();
-			present = true;
+			pacer.EndFrame(core.GetAPU()->IsProducingSamples());
+			UpdateFrameSkip();
+			present = core.GetGPU()->IsFrameRendered();
 		}
 		else
 		{
+			ResetFrameSkip();
 			if (DebuggerTick(false))
+			{
+				pacer.EndFrame(core.GetAPU()->IsProducingSamples());
 				present = true;
+			}
 		}
 	}
-	else if (GMsgPad.StepType != StepType::None)
+	else
 	{
-		if (DebuggerTick(true))
+		ResetFrameSkip();
+		pacer.Reset();
+
+		if (GMsgPad.StepType != StepType::None && DebuggerTick(true))
+		{
+			pacer.EndFrame(false);
 			present = true;
+		}
 	}
 
 	if (debugger.IsInitialized())
@@ -491,6 +623,37 @@ bool GemApp::LoopWork()
 	return present;
 }
 
+void GemApp::UpdateFrameSkip()
+{
+	using namespace std::chrono;
+
+	// Every loop emulates one frame, so whatever wall time it took beyond that is lag. The lag is capped so
+	// a long stall (e.g. dragging the window) doesn't leave the screen skipping for seconds afterwards.
+	steady_clock::time_point now = steady_clock::now();
+
+	if (lastFrameTime.time_since_epoch().count() != 0)
+	{
+		duration<float, milli> elapsed = now - lastFrameTime;
+		frameLag = clamp(frameLag + elapsed.count() - FramePacer::FrameDuration, 0.0f, FramePacer::FrameDuration * FramePacer::MaxFrameLag);
+	}
+
+	lastFrameTime = now;
+
+	int skip = min(int(frameLag / FramePacer::FrameDuration), max(GemConfig::Get().MaxFrameSkip, 0));
+	if (skip != core.GetGPU()->GetFrameSkip())
+		core.GetGPU()->SetFrameSkip(skip);
+}
+
+void GemApp::ResetFrameSkip()
+{
+	// Paused, stepping or rewinding, every frame is drawn and the time spent doesn't count as lag
+	lastFrameTime = std::chrono::steady_clock::time_point();
+	frameLag = 0;
+
+	if (core.GetGPU()->GetFrameSkip() != 0)
+		core.GetGPU()->SetFrameSkip(0);
+}
+
 // Tick the core while also evaluating break points. 
 // Ticking stops on 3 conditions: vblank, breakpoint hit, stepping finished.
 bool GemApp::DebuggerTick(bool emu_paused)
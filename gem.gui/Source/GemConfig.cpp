@@ -34,6 +34,9 @@ GemConfig::GemConfig()
 	, NoSound(false)
 	, ForceDMGMode(false)
 	, PauseAfterOpen(false)
+	, CaptureStems(false)
+	, GBSSong(0)
+	, RenderSeconds(0.0f)
 	, ResolutionScale(3.0f)
 	, UpKey(SDLK_UP)
 	, DownKey(SDLK_DOWN)
@@ -51,11 +54,15 @@ GemConfig::GemConfig()
 	, RewindKey('r')
 	, RewindUndoKey('t')
 	, RewindClearBufferOnStop(true)
+	, MaxFrameSkip(4)
+	, PipelinedRendering(false)
+	, AccurateMode3(false)
+	, ThreadedAudio(false)
 {
-	Colour0 = GemPalette::Black();
-	Colour1 = GemPalette::DarkGrey();
-	Colour2 = GemPalette::LightGrey();
-	Colour3 = GemPalette::White();
+	Colour0 = GemPalette::White();
+	Colour1 = GemPalette::LightGrey();
+	Colour2 = GemPalette::DarkGrey();
+	Colour3 = GemPalette::Black();
 
 	fs::path config_path(CONFIG_FILE_NAME);
 
@@ -90,6 +97,10 @@ void GemConfig::Save()
 		WRITE_SETTING(RewindKey);
 		WRITE_SETTING(RewindUndoKey);
 		WRITE_SETTING(RewindClearBufferOnStop);
+		WRITE_SETTING(MaxFrameSkip);
+		WRITE_SETTING(PipelinedRendering);
+		WRITE_SETTING(AccurateMode3);
+		WRITE_SETTING(ThreadedAudio);
 
 		WRITE_HEX_SETTING(UpKey);
 		WRITE_HEX_SETTING(DownKey);
@@ -152,6 +163,10 @@ void GemConfig::Load(std::istream& stream)
 				PARSE_INT(key, value, RewindKey)
 				PARSE_INT(key, value, RewindUndoKey)
 				PARSE_BOOL(key, value, RewindClearBufferOnStop)
+				PARSE_INT(key, value, MaxFrameSkip)
+				PARSE_BOOL(key, value, PipelinedRendering)
+				PARSE_BOOL(key, value, AccurateMode3)
+				PARSE_BOOL(key, value, ThreadedAudio)
 
 				PARSE_INT(key, value, UpKey)
 				PARSE_INT(key, value, DownKey)
@@ -178,11 +193,6 @@ void GemConfig::Load(std::istream& stream)
 					Colour2 = GemColour(stoi(match[7], nullptr, 16), stoi(match[8], nullptr, 16), stoi(match[9], nullptr, 16));
 					Colour3 = GemColour(stoi(match[10], nullptr, 16), stoi(match[11], nullptr, 16), stoi(match[12], nullptr, 16));
 				}
-
-				GemPalette::ReAssign(0, Colour0);
-				GemPalette::ReAssign(1, Colour1);
-				GemPalette::ReAssign(2, Colour2);
-				GemPalette::ReAssign(3, Colour3);
 			}
 		}
 	}
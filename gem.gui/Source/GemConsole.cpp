@@ -413,6 +413,8 @@ void GemConsole::DefineCommands()
     ADD_COMMAND("pause", CommandType::Pause);
 
     ADD_COMMAND("rwstats", CommandType::RewindStats);
+    ADD_COMMAND("austats", CommandType::AudioStats);
+    ADD_COMMAND_STR("austats", CommandType::AudioStats);
 
     ADD_COMMAND("save", CommandType::Save);
 
@@ -20,6 +20,8 @@
 #include "Util.h"
 #include "MsgPad.h"
 #include "GemDebugger.h"
+#include "GemSoundStream.h"
+#include "FramePacer.h"
 #include <GemConfig.h>
 
 using namespace std;
@@ -36,6 +38,8 @@ static char id_buffer[32];
 
 GemDebugger::GemDebugger()
 	: core(nullptr)
+	, sound(nullptr)
+	, pacer(nullptr)
 	, window(nullptr)
 	, windowId(0)
 	, currentDisassemblyChunk(nullptr)
@@ -119,17 +123,17 @@ bool GemDebugger::Init()
 
 	for (int i = 0; i < GPU::NumSprites; i++)
 	{
-		spriteBuffers[i] = ColourBuffer(8, 16);
+		spriteBuffers[i] = PixelBuffer(8, 16);
 	}
 
 	for (int i = 0; i < GPU::NumTilesPerSet; i++)
 	{
-		tileBuffers[i] = ColourBuffer(8, 8);
+		tileBuffers[i] = PixelBuffer(8, 8);
 	}
 
 	for (int i = 0; i < GPU::NumPaletteColours; i++)
 	{
-		paletteBuffers[i] = ColourBuffer(2, 2);
+		paletteBuffers[i] = PixelBuffer(2, 2);
 	}
 
 	GemConsole::Get().SetHandler(ConsoleHandler);
@@ -732,7 +736,7 @@ void GemDebugger::LayoutWidgets()
 						ImGui::SetNextItemWidth(40);
 						static bool apu_chan3 = true;
 						ImGui::Checkbox("Channel 3", &apu_chan3);
-						core->GetAPU()->SetChannelMask(0, apu_chan3);
+						core->GetAPU()->SetChannelMask(2, apu_chan3);
 
 						ImGui::TableNextRow();
 						ImGui::TableSetColumnIndex(1);
@@ -744,6 +748,12 @@ void GemDebugger::LayoutWidgets()
 						ImGui::EndTable();
 					}
 
+					ImGui::Separator();
+
+					ImGui::TableNextRow();
+					ImGui::TableSetColumnIndex(0);
+					LayoutAudioStats();
+
 					ImGui::EndTable();
 				}
 
@@ -1276,6 +1286,44 @@ void GemDebugger::LayoutAudioVisuals()
 	}
 }
 
+void GemDebugger::LayoutAudioStats()
+{
+	ImGui::Text("Latency");
+
+	if (!sound || !pacer || !sound->Ring())
+	{
+		ImGui::Text("No audio device");
+		return;
+	}
+
+	const AudioRing* ring = sound->Ring();
+	const PacerStats& stats = pacer->Stats();
+
+	ImGui::Text("Estimate: %.1f ms (%d frames queued)", sound->LatencyEstimate(), ring->QueuedFrames());
+	ImGui::Text("Underruns: %u (%u frames padded)  Overruns: %u", ring->Underruns(), ring->PaddedFrames(), ring->Overruns());
+	ImGui::Text("Pacing: %u waits, %u sleeps, %u late, %u timed out", stats.Waits, stats.Sleeps, stats.Late, stats.Timeouts);
+	ImGui::Text("Rate adjustment: %.2f%%", pacer->RateAdjustment() * 100);
+
+	float counts[AudioHistogram::BucketCount];
+	const AudioHistogram* histograms[] = { &ring->FillAtWrite(), &ring->WriteInterval() };
+	const char* labels[] = { "Queued at write", "Between writes" };
+
+	for (int h = 0; h < 2; h++)
+	{
+		for (int i = 0; i < AudioHistogram::BucketCount; i++)
+			counts[i] = float(histograms[h]->Count(i));
+
+		string overlay = StringFmt("%.0f ms buckets, mean %.1f, max %.1f", histograms[h]->BucketWidth(), histograms[h]->Mean(), histograms[h]->Max());
+		ImGui::PlotHistogram(labels[h], counts, AudioHistogram::BucketCount, 0, overlay.c_str(), 0, FLT_MAX, ImVec2(0, 60));
+	}
+
+	if (ImGui::Button("Reset Statistics"))
+	{
+		sound->ResetStats();
+		pacer->ResetStats();
+	}
+}
+
 void GemDebugger::HandleConsoleCommand(Command& cmd, GemConsole& console)
 {
 	namespace fs = std::filesystem;
@@ -1341,6 +1389,25 @@ void GemDebugger::HandleConsoleCommand(Command& cmd, GemConsole& console)
 			GMsgPad.PrintRewindStats = true;
 			break;
 		}
+		case CommandType::AudioStats:
+		{
+			if (!sound || !pacer)
+				break;
+
+			if (StringEquals(cmd.StrArg0, "reset", true))
+			{
+				sound->ResetStats();
+				pacer->ResetStats();
+				console.PrintLn("Audio statistics reset");
+			}
+			else
+			{
+				console.PrintLn("** AUDIO STATISTICS **");
+				console.PrintLn("%s", sound->GetStatsSummary().c_str());
+				console.PrintLn("%s", pacer->GetStatsSummary().c_str());
+			}
+			break;
+		}
 		case CommandType::Save:
 		{
 			if (!core->GetCartridgeReader())
@@ -1601,6 +1668,12 @@ void GemDebugger::HandleEvent(SDL_Event& event)
 		running = false;
 }
 
+void GemDebugger::SetAudio(GemSoundStream* sound_ptr, FramePacer* pacer_ptr)
+{
+	sound = sound_ptr;
+	pacer = pacer_ptr;
+}
+
 void GemDebugger::SetCore(Gem* ptr)
 {
 	core = ptr;
@@ -1675,27 +1748,16 @@ bool GemDebugger::CaptureScreenshot(std::string filename)
 
 	bool saved = false;
 
-	if (SDL_Surface* surface = SDL_CreateRGBSurface(0, GPU::LCDWidth, GPU::LCDHeight, 32, 0, 0, 0, 0))
+	const PixelBuffer& frame = core->GetGPU()->GetFrameBuffer();
+	Uint32 surface_format = frame.Format == PixelFormat::BGRA ? SDL_PIXELFORMAT_BGRA32 : SDL_PIXELFORMAT_RGBA32;
+
+	if (SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, frame.Width, frame.Height, 32, surface_format))
 	{
-		const ColourBuffer& frame = core->GetGPU()->GetFrameBuffer();
 		uint8_t* pixels = (uint8_t*)surface->pixels;
-		int index;
+		int row_size = frame.Width * sizeof(uint32_t);
 
-		for (int i = 0; i < frame.Count(); i++)
-		{
-			index = i * 4;
-#if SDL_BYTEORDER == SDL_BIG_ENDIAN
-			pixels[index + 0] = frame[i].Alpha;
-			pixels[index + 1] = frame[i].Red;
-			pixels[index + 2] = frame[i].Green;
-			pixels[index + 3] = frame[i].Blue;
-#else
-			pixels[index + 0] = frame[i].Blue;
-			pixels[index + 1] = frame[i].Green;
-			pixels[index + 2] = frame[i].Red;
-			pixels[index + 3] = frame[i].Alpha;
-#endif
-		}
+		for (int y = 0; y < frame.Height; y++)
+			memcpy(pixels + y * surface->pitch, frame.Ptr() + y * frame.Width, row_size);
 
 		auto s = save_path.string();
 		const char* fullpath = s.c_str();
@@ -1,5 +1,8 @@
 
 #include <cassert>
+#include <algorithm>
+#include <sstream>
+#include <iomanip>
 
 #include "Core/APU.h"
 #include "Core/GemConstants.h"
@@ -13,6 +16,8 @@ GemSoundStream::GemSoundStream()
 	: playing(false)
 	, initialized(false)
 	, device(0)
+	, sampleRate(0)
+	, deviceFrames(0)
 {
 }
 
@@ -30,14 +35,15 @@ bool GemSoundStream::Init(shared_ptr<APU> ptr)
 	SDL_AudioSpec requested, obtained;
 
 	memset(&requested, 0, sizeof(SDL_AudioSpec));
-	requested.freq = 44100;
+	requested.freq = GemConstants::SampleRate;
 	requested.format = AUDIO_F32SYS;
 	requested.channels = 2;
-	requested.samples = APU::AudioQueueSampleCount;
-	requested.callback = nullptr;
-	requested.userdata = nullptr;
+	requested.samples = CallbackFrameCount;
+	requested.callback = AudioCallback;
+	requested.userdata = this;
 
-	device = SDL_OpenAudioDevice(nullptr, 0, &requested, &obtained, 0);
+	// Take whatever rate the device prefers, the APU resamples to it
+	device = SDL_OpenAudioDevice(nullptr, 0, &requested, &obtained, SDL_AUDIO_ALLOW_FREQUENCY_CHANGE);
 	if (device == 0)
 	{
 		LOG_ERROR("Failed to open audio device: %s", SDL_GetError());
@@ -50,8 +56,16 @@ bool GemSoundStream::Init(shared_ptr<APU> ptr)
 		return false;
 	}
 
+	// A quarter of a second is plenty of headroom for the emulation thread's jitter
+	ring = make_unique<AudioRing>(obtained.freq / 4);
+	ring->SetSampleRate(obtained.freq);
+	sampleRate = obtained.freq;
+	deviceFrames = obtained.samples;
+
 	apu = ptr;
-	apu->SetAudioQueue(this);
+	apu->SetSampleRate(obtained.freq);
+	apu->SetAudioRing(ring.get());
+	LOG_INFO("Audio device opened at %d Hz", obtained.freq);
 	playing = false;
 
 	initialized = true;
@@ -76,29 +90,94 @@ void GemSoundStream::Pause()
 	playing = false;
 }
 
-int GemSoundStream::GetQueuedSampleCount()
+int GemSoundStream::GetQueuedFrameCount() const
 {
-	int size = SDL_GetQueuedAudioSize(device);
-	return size / sizeof(float);
+	return ring ? ring->QueuedFrames() : 0;
 }
 
-void GemSoundStream::ClearQueue()
+float GemSoundStream::LatencyEstimate() const
+{
+	if (!ring || sampleRate == 0)
+		return 0;
+
+	return float(ring->QueuedFrames() + deviceFrames) * 1000 / sampleRate;
+}
+
+static void PrintHistogram(stringstream& ss, const AudioHistogram& histogram)
 {
-	SDL_ClearQueuedAudio(device);
+	uint32_t total = max(histogram.Total(), 1u);
+	float width = histogram.BucketWidth();
+
+	for (int i = 0; i < AudioHistogram::BucketCount; i++)
+	{
+		ss << "  " << setw(3) << int(i * width);
+		if (i < AudioHistogram::BucketCount - 1)
+			ss << "-" << setw(3) << left << int((i + 1) * width) << right;
+		else
+			ss << "+   ";
+
+		ss << " ms: " << setw(7) << histogram.Count(i) << " (" << (100 * histogram.Count(i) / total) << "%)" << endl;
+	}
+
+	ss << "  Mean: " << histogram.Mean() << " ms, max: " << histogram.Max() << " ms" << endl;
 }
 
-void GemSoundStream::PushAudioData(const DArray<float>& buffer)
+string GemSoundStream::GetStatsSummary() const
 {
-	if (SDL_QueueAudio(device,
-		(void*)buffer.Ptr(),
-		buffer.Count() * sizeof(float)) != 0)
+	stringstream ss;
+
+	if (!ring)
 	{
-		LOG_ERROR("SDL_QueueAudio failed: %s", SDL_GetError());
+		ss << "No audio device" << endl;
+		return ss.str();
 	}
+
+	ss << fixed << setprecision(1);
+	ss << "Device:            " << sampleRate << " Hz, " << deviceFrames << " frame buffer" << endl;
+	ss << "Queued now:        " << ring->QueuedFrames() << " frames" << endl;
+	ss << "Latency estimate:  " << LatencyEstimate() << " ms" << endl;
+	ss << "Underruns:         " << ring->Underruns() << " (" << ring->PaddedFrames() << " frames padded)" << endl;
+	ss << "Overruns:          " << ring->Overruns() << endl;
+	ss << "Queued at each write (" << ring->FillAtWrite().Total() << " writes):" << endl;
+	PrintHistogram(ss, ring->FillAtWrite());
+	ss << "Time between writes:" << endl;
+	PrintHistogram(ss, ring->WriteInterval());
+
+	return ss.str();
+}
+
+void GemSoundStream::ResetStats()
+{
+	if (ring)
+		ring->ResetCounters();
+}
+
+void GemSoundStream::ClearQueue()
+{
+	if (!initialized)
+		return;
+
+	// The ring may only be emptied from the consumer's side
+	SDL_LockAudioDevice(device);
+	ring->Clear();
+	SDL_UnlockAudioDevice(device);
+}
+
+void SDLCALL GemSoundStream::AudioCallback(void* userdata, Uint8* stream, int len)
+{
+	GemSoundStream* self = static_cast<GemSoundStream*>(userdata);
+	self->ring->Read(reinterpret_cast<float*>(stream), len / (2 * sizeof(float)));
 }
 
 void GemSoundStream::Shutdown()
 {
+	if (initialized)
+	{
+		SDL_CloseAudioDevice(device);
+		apu->SetAudioRing(nullptr);
+		initialized = false;
+	}
+
 	if (SDL_WasInit(SDL_INIT_AUDIO))
 		SDL_QuitSubSystem(SDL_INIT_AUDIO);
-}
\ No newline at end of file
+}
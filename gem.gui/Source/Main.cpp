@@ -4,6 +4,7 @@
 #include <cstdlib>
 
 #include "GemApp.h"
+#include "GemConfig.h"
 #include "AppLog.h"
 
 using namespace std;
@@ -41,7 +42,10 @@ extern "C" int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPST
 
 	try
 	{
-		app.WindowLoop();
+		if (GemConfig::Get().RenderSeconds > 0)
+			app.RenderAudio();
+		else
+			app.WindowLoop();
 	}
 	catch (exception& ex)
 	{
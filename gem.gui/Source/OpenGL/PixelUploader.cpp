@@ -1,5 +1,6 @@
 
 #include <exception>
+#include <cstring>
 
 #include <glad/glad.h>
 
@@ -19,9 +20,9 @@ PixelUploader::PixelUploader()
 	pboIds[1] = 0;
 }
 
-bool PixelUploader::Init(const ColourBuffer* buffer)
+bool PixelUploader::Init(const PixelBuffer* buffer)
 {
-	clientBuffer = const_cast<ColourBuffer*>(buffer);
+	clientBuffer = const_cast<PixelBuffer*>(buffer);
 	return true;
 }
 
@@ -30,10 +31,13 @@ void PixelUploader::Upload()
 	if (!clientBuffer)
 		return;
 
-	ColourBuffer& gem_buffer = *clientBuffer;
+	PixelBuffer& gem_buffer = *clientBuffer;
 
 	GLvoid* buffer = (GLvoid*)gem_buffer.Ptr();
-	int count = gem_buffer.Count() * 4;
+	int count = gem_buffer.Size();
+
+	// Pixels are already packed in memory order so they're uploaded byte by byte
+	GLenum format = gem_buffer.Format == PixelFormat::BGRA ? GL_BGRA : GL_RGBA;
 
 	if (!buffersCreated)
 	{
@@ -43,7 +47,7 @@ void PixelUploader::Upload()
 		_GL_WRAP3(glTexParameteri, GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 		_GL_WRAP3(glTexParameteri, GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
 		_GL_WRAP3(glTexParameteri, GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-		_GL_WRAP9(glTexImage2D, GL_TEXTURE_2D, 0, GL_RGBA8, gem_buffer.Width, gem_buffer.Height, 0, GL_RGBA, GL_UNSIGNED_INT_8_8_8_8, (GLvoid*)buffer);
+		_GL_WRAP9(glTexImage2D, GL_TEXTURE_2D, 0, GL_RGBA8, gem_buffer.Width, gem_buffer.Height, 0, format, GL_UNSIGNED_BYTE, (GLvoid*)buffer);
 		_GL_WRAP2(glBindTexture, GL_TEXTURE_2D, 0);
 
 
@@ -64,7 +68,7 @@ void PixelUploader::Upload()
 	_GL_WRAP2(glBindTexture, GL_TEXTURE_2D, texId);
 	_GL_WRAP2(glBindBuffer, GL_PIXEL_UNPACK_BUFFER, pboIds[index]);
 
-	_GL_WRAP9(glTexSubImage2D, GL_TEXTURE_2D, 0, 0, 0, gem_buffer.Width, gem_buffer.Height, GL_RGBA, GL_UNSIGNED_INT_8_8_8_8, 0);
+	_GL_WRAP9(glTexSubImage2D, GL_TEXTURE_2D, 0, 0, 0, gem_buffer.Width, gem_buffer.Height, format, GL_UNSIGNED_BYTE, 0);
 
 	// bind PBO to update texture source
 	_GL_WRAP2(glBindBuffer, GL_PIXEL_UNPACK_BUFFER, pboIds[nextIndex]);
@@ -76,15 +80,7 @@ void PixelUploader::Upload()
 	GLubyte* ptr = (GLubyte*)_GL_WRAP2(glMapBuffer, GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY);
 	if (ptr)
 	{
-		for (int i = 0; i < gem_buffer.Width * gem_buffer.Height * 4; i += 4)
-		{
-			// Little endian ordering
-			ptr[i + 0] = 255;
-			ptr[i + 1] = gem_buffer[i / 4].Blue;
-			ptr[i + 2] = gem_buffer[i / 4].Green;
-			ptr[i + 3] = gem_buffer[i / 4].Red;
-		}
-
+		memcpy(ptr, buffer, count);
 		_GL_WRAP1(glUnmapBuffer, GL_PIXEL_UNPACK_BUFFER);
 	}
 
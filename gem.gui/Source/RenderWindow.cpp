@@ -17,7 +17,7 @@ TTF_Font* RenderWindow::mainFont = nullptr;
 
 using namespace std;
 
-RenderWindow::RenderWindow(const char* title, int buff_width, int buff_height, IAudioQueue* queue, bool vsync, float custom_scale /*= 1*/) :
+RenderWindow::RenderWindow(const char* title, int buff_width, int buff_height, GemSoundStream* sound, bool vsync, float custom_scale /*= 1*/) :
 	bufferWidth(buff_width),
 	bufferHeight(buff_height),
 	frameCtr(0),
@@ -44,14 +44,9 @@ RenderWindow::RenderWindow(const char* title, int buff_width, int buff_height, I
 
 	Uint32 flags = SDL_RENDERER_ACCELERATED;
 	if (vsync)
-	{
 		flags |= SDL_RENDERER_PRESENTVSYNC;
-		SetFrameRateLimit(0);
-	}
-	else
-	{
-		SetFrameRateLimit(DefaultFrameRate);
-	}
+
+	adjustmentCtr = FRAME_DELAY_ADJUSTMENT_MOD;
 
 	renderer = SDL_CreateRenderer(window, -1, flags);
 	if (renderer == nullptr)
@@ -60,7 +55,7 @@ RenderWindow::RenderWindow(const char* title, int buff_width, int buff_height, I
 	if (SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255) != 0)
 		throw exception("Failed to set draw colour");
 
-	texture = SDL_CreateTexture(renderer, SDL_PixelFormatEnum::SDL_PIXELFORMAT_ARGB8888, SDL_TextureAccess::SDL_TEXTUREACCESS_STREAMING, bufferWidth, bufferHeight);
+	texture = SDL_CreateTexture(renderer, SDL_PixelFormatEnum::SDL_PIXELFORMAT_BGRA32, SDL_TextureAccess::SDL_TEXTUREACCESS_STREAMING, bufferWidth, bufferHeight);
 	if (texture == nullptr)
 		throw exception("Failed to create texture");
 
@@ -93,31 +88,26 @@ float RenderWindow::GetDpiAwareScalingFactor()
 	return scale;
 }
 
-void RenderWindow::DrawFrame(const ColourBuffer& new_frame)
+void RenderWindow::DrawFrame(const PixelBuffer& new_frame)
 {
+	// The texture is BGRA32, which is what the GPU produces by default, so the frame can go straight in
+	if (new_frame.Format == PixelFormat::BGRA)
+	{
+		if (SDL_UpdateTexture(texture, nullptr, new_frame.Ptr(), new_frame.Width * BYTES_PER_PIXEL) == 0)
+			SDL_RenderCopy(renderer, texture, nullptr, nullptr);
+
+		return;
+	}
+
 	void* ptr;
 	int pitch;
 
 	if (SDL_LockTexture(texture, nullptr, &ptr, &pitch) == 0)
 	{
-		uint8_t* pixels = (uint8_t*)ptr;
-		int index;
+		uint32_t* pixels = (uint32_t*)ptr;
 
 		for (int i = 0; i < new_frame.Count(); i++)
-		{
-			index = i * BYTES_PER_PIXEL;
-#if SDL_BYTEORDER == SDL_BIG_ENDIAN
-			pixels[index + 0] = new_frame[i].Alpha;
-			pixels[index + 1] = new_frame[i].Red;
-			pixels[index + 2] = new_frame[i].Green;
-			pixels[index + 3] = new_frame[i].Blue;
-#else
-			pixels[index + 0] = new_frame[i].Blue;
-			pixels[index + 1] = new_frame[i].Green;
-			pixels[index + 2] = new_frame[i].Red;
-			pixels[index + 3] = new_frame[i].Alpha;
-#endif
-		}
+			pixels[i] = GemColour::Unpack(new_frame[i], new_frame.Format).Pack(PixelFormat::BGRA);
 
 		SDL_UnlockTexture(texture);
 		SDL_RenderCopy(renderer, texture, nullptr, nullptr);
@@ -194,12 +184,8 @@ void RenderWindow::MonitorFrameRate()
 {
 	using namespace std::chrono;
 
-	// Basically every FRAME_DELAY_ADJUSTMENT_MOD frames we calculate the average frame time
-	// and increase or decrease fpsDelay based on that average. The important part is that
-	// the timing and adjustment include overhead from calling sleep_for
-
-	if (fpsDelay != 0)
-		this_thread::sleep_for(milliseconds(fpsDelay));
+	// Every FRAME_DELAY_ADJUSTMENT_MOD frames we calculate the average frame time for the FPS counter.
+	// The pacing itself is done by the FramePacer before the frame gets here.
 
 	if (--adjustmentCtr == 0)
 	{
@@ -209,15 +195,6 @@ void RenderWindow::MonitorFrameRate()
 		{
 			duration<float, milli> time_taken = now - lastTime;
 			avgFrameTime = time_taken.count() / FRAME_DELAY_ADJUSTMENT_MOD;
-
-			if (!vsync)
-			{
-				float diff = simFrameTime - avgFrameTime;
-				if (diff >= 1.0f)
-					fpsDelay++;
-				else if (diff <= -1.0f)
-					fpsDelay = fpsDelay > 0 ? fpsDelay - 1 : 0;
-			}
 		}
 
 		lastTime = now;
@@ -232,25 +209,6 @@ void RenderWindow::MonitorFrameRate()
 	}
 }
 
-void RenderWindow::SetFrameRateLimit(unsigned int limit) 
-{
-	if (limit == 0)
-	{
-		fpsDelay = 0;
-		simFrameTime = 0;
-	}
-	else
-	{
-		simFrameTime = 1000.0 / float(limit);
-		// Reduce the actual delay by 40% to account for overhead from sleeping
-		fpsDelay = int(simFrameTime * 0.6);
-	}
-
-	avgFrameTime = 0;
-	adjustmentCtr = FRAME_DELAY_ADJUSTMENT_MOD;
-	frLimit = limit;
-}
-
 void RenderWindow::SetTitle(const char* title)
 {
 	SDL_SetWindowTitle(window, title);
@@ -259,7 +259,7 @@ void RewindManager::GetSnapshot(RewindSnapshot& snapshot, bool include_frame_buf
 
 	for (int i = 0; i < 8; i++)
 	{
-		memcpy(joinedWorkingRAM.data() + 0x1000 * i, mmu->wramBanks[i].Ptr(), mmu->wramBanks[i].Size());
+		mmu->wramBanks[i].CopyTo(joinedWorkingRAM.data() + 0x1000 * i);
 	}
 
 	snapshot.MMU_CompressedWRAM = vector<uint8_t>(0x1000);
@@ -284,7 +284,7 @@ void RewindManager::GetSnapshot(RewindSnapshot& snapshot, bool include_frame_buf
 	int ext_ram_size = 0;
 	for (int i = 0; i < mbc.numExtRAMBanks; i++)
 	{
-		memcpy(joinedExtRAM.data() + MBC::RAMBankSize * i, mbc.extRAMBanks[i].Ptr(), mbc.extRAMBanks[i].Size());
+		mbc.extRAMBanks[i].CopyTo(joinedExtRAM.data() + MBC::RAMBankSize * i);
 		ext_ram_size += MBC::RAMBankSize;
 	}
 
@@ -344,7 +344,7 @@ void RewindManager::GetSnapshot(RewindSnapshot& snapshot, bool include_frame_buf
 
 	///////
 	// VRAM
-	memcpy(joinedVRAM.data(), gpu->vram.Ptr(), gpu->vram.Size());
+	gpu->vram.CopyTo(joinedVRAM.data());
 	CompressData(joinedVRAM.data(), joinedVRAM.size(), snapshot.GPU_CompressedVRAM);
 
 	///////
@@ -433,7 +433,7 @@ void RewindManager::ApplySnapshot(const RewindSnapshot& snapshot)
 
 	for (int i = 0; i < 8; i++)
 	{
-		memcpy(mmu->wramBanks[i].Ptr(), joinedWorkingRAM.data() + 0x1000 * i, mmu->wramBanks[i].Capacity());
+		mmu->wramBanks[i].CopyFrom(joinedWorkingRAM.data() + 0x1000 * i);
 	}
 
 	// MBC
@@ -456,7 +456,7 @@ void RewindManager::ApplySnapshot(const RewindSnapshot& snapshot)
 
 	for (int i = 0; i < mbc.numExtRAMBanks; i++)
 	{
-		memcpy(mbc.extRAMBanks[i].Ptr(), joinedExtRAM.data() + MBC::RAMBankSize * i, MBC::RAMBankSize);
+		mbc.extRAMBanks[i].CopyFrom(joinedExtRAM.data() + MBC::RAMBankSize * i);
 	}
 
 	// CGBRegisters
@@ -490,6 +490,7 @@ void RewindManager::ApplySnapshot(const RewindSnapshot& snapshot)
 
 	// GPU
 	auto gpu = core->gpu;
+	gpu->FinishRendering();
 	gpu->bCGB = snapshot.GPU_bCGB;
 	gpu->tAcc = snapshot.GPU_tAcc;
 	gpu->vramBank = snapshot.GPU_vramBank;
@@ -507,9 +508,11 @@ void RewindManager::ApplySnapshot(const RewindSnapshot& snapshot)
 	gpu->sprColourPalette = snapshot.GPU_sprColourPalette;
 	gpu->correctionMode = snapshot.GPU_correctionMode;
 	gpu->brightness = snapshot.GPU_brightness;
+	gpu->RebuildCorrectedShades();
 
 	DecompressData(snapshot.GPU_CompressedVRAM.data(), snapshot.GPU_CompressedVRAM.size(), joinedVRAM);
-	memcpy(gpu->vram.Ptr(), joinedVRAM.data(), GPU::VRAMSize);
+	gpu->vram.CopyFrom(joinedVRAM.data());
+	gpu->RebuildTileCache();
 
 	DecompressData(snapshot.GPU_CompressedSprites.data(), snapshot.GPU_CompressedSprites.size(), joinedSprites);
 	for (int i = 0; i < GPU::NumSprites; i++)
@@ -518,6 +521,13 @@ void RewindManager::ApplySnapshot(const RewindSnapshot& snapshot)
 				joinedSprites.data() + i * sizeof(SpriteData),
 				sizeof(SpriteData));
 	}
+	gpu->SpriteChanged();
+
+	// bCGB may have changed underneath the DMG/CGB specialisations
+	core->SelectModePath();
+	mmu->SelectModePath();
+	gpu->SelectModePath();
+	gpu->SyncRenderWorker();
 }
 
 void RewindManager::ClearBuffer()
@@ -558,7 +568,7 @@ bool RewindManager::StartRewind()
 	isRewinding = true;
 }
 
-void RewindManager::GetCurrentRewindFrame(ColourBuffer& framebuffer)
+void RewindManager::GetCurrentRewindFrame(PixelBuffer& framebuffer)
 {
 	if (idxRewind == idxHead) // Reached start of buffer
 	{
@@ -596,6 +606,8 @@ bool RewindManager::StopRewind(bool continueFromStart)
 	{
 		ApplySnapshot(rewindUndoSnapshot);
 		DecodeVideoFrame(rewindUndoSnapshot.GPU_CompressedFramePacket, core->gpu->frameBuffer);
+		core->gpu->pixelAttributes.Fill(0);
+		core->gpu->SyncRenderWorker();
 	}
 	else if (GemConfig::Get().RewindClearBufferOnStop)
 	{
@@ -694,7 +706,7 @@ bool RewindManager::DecompressData(const uint8_t* compressed_data, int len, vect
 #define YUV2B(Y, U, V) CLIP(( 298 * C(Y) + 516 * D(U)              + 128) >> 8)
 #pragma endregion
 
-bool RewindManager::EncodeVideoFrame(const ColourBuffer& framebuffer, AVPacket*& output_packet)
+bool RewindManager::EncodeVideoFrame(const PixelBuffer& framebuffer, AVPacket*& output_packet)
 {
 	int error_code = 0;
 
@@ -722,7 +734,7 @@ bool RewindManager::EncodeVideoFrame(const ColourBuffer& framebuffer, AVPacket*&
 			{
 				for (int j = 0; j < framebuffer.Width; j++)
 				{
-					GemColour px = framebuffer.GetPixel(j, i);
+					GemColour px = GemColour::Unpack(framebuffer[i * framebuffer.Width + j], framebuffer.Format);
 					vidFrame->data[0][i * vidFrame->linesize[0] + j] = RGB2Y(px.Red, px.Green, px.Blue);
 					vidFrame->data[1][i * vidFrame->linesize[1] + j] = RGB2U(px.Red, px.Green, px.Blue);
 					vidFrame->data[2][i * vidFrame->linesize[2] + j] = RGB2V(px.Red, px.Green, px.Blue);
@@ -730,8 +742,7 @@ bool RewindManager::EncodeVideoFrame(const ColourBuffer& framebuffer, AVPacket*&
 				}
 			}
 
-			static long frame_timestamp = 0;
-			vidFrame->pts = frame_timestamp++;
+			vidFrame->pts = vidFrameTimestamp++;
 
 			if ((error_code = avcodec_send_frame(vidEncoder, vidFrame)) >= 0)
 			{
@@ -762,7 +773,7 @@ bool RewindManager::EncodeVideoFrame(const ColourBuffer& framebuffer, AVPacket*&
 	return false;
 }
 
-bool RewindManager::DecodeVideoFrame(const AVPacket* packet, ColourBuffer& output_buffer)
+bool RewindManager::DecodeVideoFrame(const AVPacket* packet, PixelBuffer& output_buffer)
 {
 	int error_code = 0;
 
@@ -776,9 +787,9 @@ bool RewindManager::DecodeVideoFrame(const AVPacket* packet, ColourBuffer& outpu
 
 		if (error_code >= 0)
 		{
-			for (int i = 0; i < GPU::LCDHeight; i++)
+			for (int i = 0; i < output_buffer.Height; i++)
 			{
-				for (int j = 0; j < GPU::LCDWidth; j++)
+				for (int j = 0; j < output_buffer.Width; j++)
 				{
 					GemColour px;
 					uint8_t y = vidFrame->data[0][i * vidFrame->linesize[0] + j];